@@ -27,8 +27,19 @@
 
 #include <Zend/zend_exceptions.h>
 #include <Zend/zend_interfaces.h>
+#include <Zend/zend_bitset.h>
 #include <zend_smart_str.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define ZEPHIR_ESCAPE_SAFE_CSS  1
+#define ZEPHIR_ESCAPE_SAFE_JS   2
+#define ZEPHIR_ESCAPE_SAFE_HTML 4
+
 /**
  * Filter alphanum string
  */
@@ -293,3 +304,450 @@ void zephir_escape_js(zval *return_value, zval *param)
 {
 	zephir_escape_multi(return_value, param, "\\x", sizeof("\\x")-1, '\0', 1);
 }
+
+/**
+ * Byte classes used by the UTF-8 escapers. A set bit means the byte can be
+ * copied to the output as is for the given context. Bytes >= 0x80 are never
+ * safe, they start (or continue) a multibyte sequence that must be decoded
+ */
+static const unsigned char zephir_escape_safe_map[256] = {
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	6, 6, 0, 6, 6, 4, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 0, 4, 0, 6,
+	4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6,
+	4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const char zephir_escape_hex_digits[] = "0123456789abcdef";
+
+/**
+ * Returns the length of the leading run of ASCII alphanumeric characters,
+ * checked in blocks of 32 (AVX2) or 16 (SSE2) bytes
+ */
+static zend_always_inline size_t zephir_escape_alnum_span(const unsigned char *str, size_t length)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256i digit_lo = _mm256_set1_epi8('0' - 1);
+	const __m256i digit_hi = _mm256_set1_epi8('9' + 1);
+	const __m256i alpha_lo = _mm256_set1_epi8('a' - 1);
+	const __m256i alpha_hi = _mm256_set1_epi8('z' + 1);
+	const __m256i fold     = _mm256_set1_epi8(0x20);
+
+	for (; i + 32 <= length; i += 32) {
+		__m256i block = _mm256_loadu_si256((const __m256i *) (str + i));
+		__m256i lower = _mm256_or_si256(block, fold);
+		__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(block, digit_lo), _mm256_cmpgt_epi8(digit_hi, block));
+		__m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, alpha_lo), _mm256_cmpgt_epi8(alpha_hi, lower));
+		zend_ulong mask = (uint32_t) ~_mm256_movemask_epi8(_mm256_or_si256(digit, alpha));
+
+		if (mask) {
+			return i + zend_ulong_ntz(mask);
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i digit_lo = _mm_set1_epi8('0' - 1);
+	const __m128i digit_hi = _mm_set1_epi8('9' + 1);
+	const __m128i alpha_lo = _mm_set1_epi8('a' - 1);
+	const __m128i alpha_hi = _mm_set1_epi8('z' + 1);
+	const __m128i fold     = _mm_set1_epi8(0x20);
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i block = _mm_loadu_si128((const __m128i *) (str + i));
+		__m128i lower = _mm_or_si128(block, fold);
+		__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, digit_lo), _mm_cmplt_epi8(block, digit_hi));
+		__m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, alpha_lo), _mm_cmplt_epi8(lower, alpha_hi));
+		zend_ulong mask = (~_mm_movemask_epi8(_mm_or_si128(digit, alpha))) & 0xFFFF;
+
+		if (mask) {
+			return i + zend_ulong_ntz(mask);
+		}
+	}
+#endif
+
+	for (; i < length; i++) {
+		if (!(zephir_escape_safe_map[str[i]] & ZEPHIR_ESCAPE_SAFE_CSS)) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+/**
+ * Returns the length of the leading run of ASCII characters that do not
+ * need HTML escaping (everything but & " ' < >)
+ */
+static zend_always_inline size_t zephir_escape_html_span(const unsigned char *str, size_t length)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256i amp   = _mm256_set1_epi8('&');
+	const __m256i quot  = _mm256_set1_epi8('"');
+	const __m256i apos  = _mm256_set1_epi8('\'');
+	const __m256i lt    = _mm256_set1_epi8('<');
+	const __m256i gt    = _mm256_set1_epi8('>');
+
+	for (; i + 32 <= length; i += 32) {
+		__m256i block = _mm256_loadu_si256((const __m256i *) (str + i));
+		__m256i special = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(block, amp), _mm256_cmpeq_epi8(block, quot)),
+			_mm256_or_si256(
+				_mm256_cmpeq_epi8(block, apos),
+				_mm256_or_si256(_mm256_cmpeq_epi8(block, lt), _mm256_cmpeq_epi8(block, gt))
+			)
+		);
+		zend_ulong mask = (uint32_t) _mm256_movemask_epi8(_mm256_or_si256(special, block));
+
+		if (mask) {
+			return i + zend_ulong_ntz(mask);
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i amp   = _mm_set1_epi8('&');
+	const __m128i quot  = _mm_set1_epi8('"');
+	const __m128i apos  = _mm_set1_epi8('\'');
+	const __m128i lt    = _mm_set1_epi8('<');
+	const __m128i gt    = _mm_set1_epi8('>');
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i block = _mm_loadu_si128((const __m128i *) (str + i));
+		__m128i special = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(block, amp), _mm_cmpeq_epi8(block, quot)),
+			_mm_or_si128(
+				_mm_cmpeq_epi8(block, apos),
+				_mm_or_si128(_mm_cmpeq_epi8(block, lt), _mm_cmpeq_epi8(block, gt))
+			)
+		);
+		zend_ulong mask = (zend_ulong) _mm_movemask_epi8(_mm_or_si128(special, block));
+
+		if (mask) {
+			return i + zend_ulong_ntz(mask);
+		}
+	}
+#endif
+
+	for (; i < length; i++) {
+		if (!(zephir_escape_safe_map[str[i]] & ZEPHIR_ESCAPE_SAFE_HTML)) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+/**
+ * Decodes one UTF-8 sequence. Returns its length in bytes or 0 if the
+ * sequence is malformed, overlong, a surrogate or beyond U+10FFFF
+ */
+static zend_always_inline size_t zephir_utf8_decode(const unsigned char *str, size_t length, unsigned int *code_point)
+{
+	unsigned int c = str[0];
+
+	if (c < 0x80) {
+		*code_point = c;
+		return 1;
+	}
+
+	if (c < 0xC2) {
+		return 0;
+	}
+
+	if (c < 0xE0) {
+		if (length < 2 || (str[1] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*code_point = ((c & 0x1F) << 6) | (str[1] & 0x3F);
+		return 2;
+	}
+
+	if (c < 0xF0) {
+		if (length < 3 || (str[1] & 0xC0) != 0x80 || (str[2] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*code_point = ((c & 0x0F) << 12) | ((str[1] & 0x3F) << 6) | (str[2] & 0x3F);
+		if (*code_point < 0x800 || (*code_point >= 0xD800 && *code_point <= 0xDFFF)) {
+			return 0;
+		}
+		return 3;
+	}
+
+	if (c < 0xF5) {
+		if (length < 4 || (str[1] & 0xC0) != 0x80 || (str[2] & 0xC0) != 0x80 || (str[3] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*code_point = ((c & 0x07) << 18) | ((str[1] & 0x3F) << 12) | ((str[2] & 0x3F) << 6) | (str[3] & 0x3F);
+		if (*code_point < 0x10000 || *code_point > 0x10FFFF) {
+			return 0;
+		}
+		return 4;
+	}
+
+	return 0;
+}
+
+/**
+ * Escapes a UTF-8 string for CSS or JavaScript without converting it to
+ * UTF-32 first. Runs of safe characters are copied in bulk and escape
+ * sequences are written to a stack buffer, so no allocation happens per
+ * escaped character. Returns false if the input is empty, contains a NUL
+ * code point or is not valid UTF-8 so that the caller can fall back to
+ * zephir_escape_multi()
+ */
+static void zephir_escape_utf8(zval *return_value, zval *param, const char *escape_char, unsigned int escape_length, char escape_extra, unsigned char safe_class)
+{
+	const unsigned char *str;
+	size_t i = 0, length, span, sequence;
+	unsigned int code_point;
+	char buffer[16], *ptr;
+	smart_str escaped_str = {0};
+	zval copy;
+	int use_copy = 0;
+
+	if (Z_TYPE_P(param) != IS_STRING) {
+		use_copy = zend_make_printable_zval(param, &copy);
+		if (use_copy) {
+			param = &copy;
+		}
+	}
+
+	str    = (const unsigned char *) Z_STRVAL_P(param);
+	length = Z_STRLEN_P(param);
+
+	if (length == 0) {
+		goto fail;
+	}
+
+	smart_str_alloc(&escaped_str, length + (length >> 2), 0);
+
+	while (i < length) {
+		span = zephir_escape_alnum_span(str + i, length - i);
+
+		/**
+		 * The JavaScript whitelist is too irregular for a vector compare, so
+		 * it extends the alphanumeric run through the lookup table
+		 */
+		if (safe_class == ZEPHIR_ESCAPE_SAFE_JS) {
+			while (i + span < length && (zephir_escape_safe_map[str[i + span]] & ZEPHIR_ESCAPE_SAFE_JS)) {
+				span++;
+				span += zephir_escape_alnum_span(str + i + span, length - i - span);
+			}
+		}
+
+		if (span) {
+			smart_str_appendl(&escaped_str, (const char *) str + i, span);
+			i += span;
+			if (i >= length) {
+				break;
+			}
+		}
+
+		sequence = zephir_utf8_decode(str + i, length - i, &code_point);
+
+		/**
+		 * CSS 2.1 section 4.1.3: "It is undefined in CSS 2.1 what happens if a
+		 * style sheet does contain a character with Unicode codepoint zero."
+		 */
+		if (sequence == 0 || code_point == 0) {
+			goto fail;
+		}
+
+		i += sequence;
+
+		/**
+		 * Write the hexadecimal representation backwards from the end of
+		 * the buffer
+		 */
+		ptr = buffer + sizeof(buffer);
+		if (escape_extra != '\0') {
+			*--ptr = escape_extra;
+		}
+		do {
+			*--ptr = zephir_escape_hex_digits[code_point & 0x0F];
+			code_point >>= 4;
+		} while (code_point);
+		ptr -= escape_length;
+		memcpy(ptr, escape_char, escape_length);
+
+		smart_str_appendl(&escaped_str, ptr, buffer + sizeof(buffer) - ptr);
+	}
+
+	if (use_copy) {
+		zval_dtor(param);
+	}
+
+	smart_str_0(&escaped_str);
+
+	if (escaped_str.s) {
+		RETURN_STR(escaped_str.s);
+	} else {
+		RETURN_EMPTY_STRING();
+	}
+
+fail:
+	smart_str_free(&escaped_str);
+	if (use_copy) {
+		zval_dtor(param);
+	}
+	RETURN_FALSE;
+}
+
+/**
+ * Escapes non-alphanumeric characters of a UTF-8 string to \HH+space
+ */
+void zephir_escape_css_utf8(zval *return_value, zval *param)
+{
+	zephir_escape_utf8(return_value, param, "\\", sizeof("\\")-1, ' ', ZEPHIR_ESCAPE_SAFE_CSS);
+}
+
+/**
+ * Escapes non-alphanumeric characters of a UTF-8 string to \xHH+
+ */
+void zephir_escape_js_utf8(zval *return_value, zval *param)
+{
+	zephir_escape_utf8(return_value, param, "\\x", sizeof("\\x")-1, '\0', ZEPHIR_ESCAPE_SAFE_JS);
+}
+
+/**
+ * Escapes a UTF-8 string the same way htmlspecialchars() does with
+ * double_encode enabled. Returns false when the flags or the input need
+ * the full implementation (ENT_DISALLOWED, invalid UTF-8)
+ */
+void zephir_escape_html(zval *return_value, zval *param, zval *flags)
+{
+	const unsigned char *str;
+	const char *apos, *entity;
+	size_t i = 0, length, span, sequence, apos_length, entity_length;
+	unsigned int code_point;
+	zend_long quote_flags;
+	smart_str escaped_str = {0};
+	zval copy;
+	int use_copy = 0;
+
+	quote_flags = zval_get_long(flags);
+	if (quote_flags & ENT_HTML_SUBSTITUTE_DISALLOWED_CHARS) {
+		RETURN_FALSE;
+	}
+
+	if ((quote_flags & ENT_HTML_DOC_TYPE_MASK) == ENT_HTML_DOC_HTML401) {
+		apos        = "&#039;";
+		apos_length = sizeof("&#039;")-1;
+	} else {
+		apos        = "&apos;";
+		apos_length = sizeof("&apos;")-1;
+	}
+
+	if (Z_TYPE_P(param) != IS_STRING) {
+		use_copy = zend_make_printable_zval(param, &copy);
+		if (use_copy) {
+			param = &copy;
+		}
+	}
+
+	str    = (const unsigned char *) Z_STRVAL_P(param);
+	length = Z_STRLEN_P(param);
+
+	/**
+	 * Nothing to escape, return the same string
+	 */
+	span = zephir_escape_html_span(str, length);
+	if (span == length) {
+		if (use_copy) {
+			RETURN_ZVAL(param, 0, 0);
+		}
+		RETURN_STR_COPY(Z_STR_P(param));
+	}
+
+	smart_str_alloc(&escaped_str, length + (length >> 3), 0);
+
+	while (i < length) {
+		if (span) {
+			smart_str_appendl(&escaped_str, (const char *) str + i, span);
+			i += span;
+			if (i >= length) {
+				break;
+			}
+		}
+
+		entity = NULL;
+		entity_length = 0;
+
+		switch (str[i]) {
+			case '&':
+				entity = "&amp;";
+				entity_length = sizeof("&amp;")-1;
+				break;
+
+			case '<':
+				entity = "&lt;";
+				entity_length = sizeof("&lt;")-1;
+				break;
+
+			case '>':
+				entity = "&gt;";
+				entity_length = sizeof("&gt;")-1;
+				break;
+
+			case '"':
+				if (quote_flags & ENT_HTML_QUOTE_DOUBLE) {
+					entity = "&quot;";
+					entity_length = sizeof("&quot;")-1;
+				}
+				break;
+
+			case '\'':
+				if (quote_flags & ENT_HTML_QUOTE_SINGLE) {
+					entity = apos;
+					entity_length = apos_length;
+				}
+				break;
+		}
+
+		if (entity) {
+			smart_str_appendl(&escaped_str, entity, entity_length);
+			i++;
+		} else if (str[i] < 0x80) {
+			smart_str_appendc(&escaped_str, str[i]);
+			i++;
+		} else {
+			sequence = zephir_utf8_decode(str + i, length - i, &code_point);
+			if (sequence == 0) {
+				smart_str_free(&escaped_str);
+				if (use_copy) {
+					zval_dtor(param);
+				}
+				RETURN_FALSE;
+			}
+
+			smart_str_appendl(&escaped_str, (const char *) str + i, sequence);
+			i += sequence;
+		}
+
+		span = zephir_escape_html_span(str + i, length - i);
+	}
+
+	if (use_copy) {
+		zval_dtor(param);
+	}
+
+	smart_str_0(&escaped_str);
+
+	if (escaped_str.s) {
+		RETURN_STR(escaped_str.s);
+	} else {
+		RETURN_EMPTY_STRING();
+	}
+}
@@ -22,6 +22,8 @@
 #include <zend_smart_str.h>
 #endif
 
+#include <ext/json/php_json.h>
+
 /**
  * Destroyes the prepared ASTs
  */
@@ -89,3 +91,164 @@ void phalcon_orm_singlequotes(zval *return_value, zval *str) {
 	smart_str_free(&escaped_str);
 	RETURN_EMPTY_STRING();
 }
+
+/**
+ * Renames the keys of every row by position. header holds the new name of
+ * each column in the order the columns are fetched, NULL to drop a column.
+ * The key strings are shared by all the rows
+ */
+void phalcon_orm_rename_rows(zval *return_value, zval *rows, zval *header) {
+
+	zval *row, *value, *key, renamed;
+	HashTable *keys;
+	uint32_t columns, position, size = 0;
+
+	if (Z_TYPE_P(rows) != IS_ARRAY || Z_TYPE_P(header) != IS_ARRAY) {
+		RETURN_EMPTY_ARRAY();
+	}
+
+	keys    = Z_ARRVAL_P(header);
+	columns = zend_hash_num_elements(keys);
+
+	ZEND_HASH_FOREACH_VAL(keys, key) {
+		if (Z_TYPE_P(key) == IS_STRING) {
+			size++;
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(rows)));
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(rows), row) {
+		ZVAL_DEREF(row);
+		if (Z_TYPE_P(row) != IS_ARRAY) {
+			continue;
+		}
+
+		array_init_size(&renamed, size);
+		position = 0;
+
+		ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(row), value) {
+			if (position >= columns) {
+				break;
+			}
+
+			key = zend_hash_index_find(keys, position++);
+			if (key == NULL || Z_TYPE_P(key) != IS_STRING) {
+				continue;
+			}
+
+			Z_TRY_ADDREF_P(value);
+			zend_symtable_update(Z_ARRVAL(renamed), Z_STR_P(key), value);
+		} ZEND_HASH_FOREACH_END();
+
+		zend_hash_next_index_insert_new(Z_ARRVAL_P(return_value), &renamed);
+	} ZEND_HASH_FOREACH_END();
+}
+
+/**
+ * Encodes the rows as a JSON array of objects without building the renamed
+ * rows first. The keys are encoded once. Returns false if a value cannot be
+ * encoded
+ */
+void phalcon_orm_rows_to_json(zval *return_value, zval *rows, zval *header, zval *flags) {
+
+	zval *row, *value, *key;
+	HashTable *keys;
+	smart_str buffer = {0};
+	smart_str *encoded_keys;
+	uint32_t columns, position, i;
+	zend_bool first_row = 1, first_column;
+	zend_long options;
+
+	if (Z_TYPE_P(rows) != IS_ARRAY || Z_TYPE_P(header) != IS_ARRAY) {
+		RETURN_FALSE;
+	}
+
+	options = zval_get_long(flags);
+
+	keys    = Z_ARRVAL_P(header);
+	columns = zend_hash_num_elements(keys);
+
+	/**
+	 * "key": once per column, numeric check never applies to keys
+	 */
+	encoded_keys = ecalloc(columns ? columns : 1, sizeof(smart_str));
+
+	for (i = 0; i < columns; i++) {
+		key = zend_hash_index_find(keys, i);
+		if (key == NULL || Z_TYPE_P(key) != IS_STRING) {
+			continue;
+		}
+
+		if (php_json_encode_ex(&encoded_keys[i], key, (int) (options & ~PHP_JSON_NUMERIC_CHECK), PHP_JSON_PARSER_DEFAULT_DEPTH) == FAILURE) {
+			goto failure;
+		}
+
+		smart_str_appendc(&encoded_keys[i], ':');
+		smart_str_0(&encoded_keys[i]);
+	}
+
+	smart_str_alloc(&buffer, 64 * zend_hash_num_elements(Z_ARRVAL_P(rows)) + 2, 0);
+	smart_str_appendc(&buffer, '[');
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(rows), row) {
+		ZVAL_DEREF(row);
+		if (Z_TYPE_P(row) != IS_ARRAY) {
+			continue;
+		}
+
+		if (!first_row) {
+			smart_str_appendc(&buffer, ',');
+		}
+
+		first_row    = 0;
+		first_column = 1;
+		position     = 0;
+
+		smart_str_appendc(&buffer, '{');
+
+		ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(row), value) {
+			if (position >= columns) {
+				break;
+			}
+
+			i = position++;
+			if (encoded_keys[i].s == NULL) {
+				continue;
+			}
+
+			if (!first_column) {
+				smart_str_appendc(&buffer, ',');
+			}
+
+			first_column = 0;
+
+			smart_str_append(&buffer, encoded_keys[i].s);
+
+			if (php_json_encode_ex(&buffer, value, (int) options, PHP_JSON_PARSER_DEFAULT_DEPTH) == FAILURE) {
+				goto failure;
+			}
+		} ZEND_HASH_FOREACH_END();
+
+		smart_str_appendc(&buffer, '}');
+	} ZEND_HASH_FOREACH_END();
+
+	smart_str_appendc(&buffer, ']');
+	smart_str_0(&buffer);
+
+	for (i = 0; i < columns; i++) {
+		smart_str_free(&encoded_keys[i]);
+	}
+	efree(encoded_keys);
+
+	RETURN_STR(buffer.s);
+
+failure:
+	for (i = 0; i < columns; i++) {
+		smart_str_free(&encoded_keys[i]);
+	}
+	efree(encoded_keys);
+	smart_str_free(&buffer);
+
+	RETURN_FALSE;
+}
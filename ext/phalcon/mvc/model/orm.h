@@ -10,3 +10,5 @@
 
 void phalcon_orm_destroy_cache();
 void phalcon_orm_singlequotes(zval *return_value, zval *str);
+void phalcon_orm_rename_rows(zval *return_value, zval *rows, zval *header);
+void phalcon_orm_rows_to_json(zval *return_value, zval *rows, zval *header, zval *flags);
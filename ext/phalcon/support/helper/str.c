@@ -0,0 +1,535 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+
+#include <ext/standard/php_string.h>
+#include <zend_smart_str.h>
+
+#include "phalcon/support/helper/str.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define PHALCON_STR_LOWER(c) (((c) >= 'A' && (c) <= 'Z') ? (c) + 32 : (c))
+#define PHALCON_STR_UPPER(c) (((c) >= 'a' && (c) <= 'z') ? (c) - 32 : (c))
+
+/**
+ * Transliteration of U+00C0 - U+00FF, indexed by the second byte of the
+ * UTF-8 sequence (0xC3 0x80 - 0xC3 0xBF). Same values as
+ * Phalcon\Support\Helper\Str\Friendly::getMatrix(), NULL when there is none
+ */
+static const char *phalcon_str_latin1[64] = {
+	"A",  "A", "A", "A", "A", "A", "A",  "C",
+	"E",  "E", "E", "E", "I", "I", "I",  "I",
+	"Dj", "N", "O", "O", "O", "O", "O",  NULL,
+	"O",  "U", "U", "U", "U", "Y", "B",  "Ss",
+	"a",  "a", "a", "a", "a", "a", "a",  "c",
+	"e",  "e", "e", "e", "i", "i", "i",  "i",
+	"o",  "n", "o", "o", "o", "o", "o",  NULL,
+	"o",  "u", "u", "u", NULL, "y", "b", "y",
+};
+
+/**
+ * Returns the transliteration of a two byte UTF-8 sequence or NULL
+ */
+static zend_always_inline const char *phalcon_str_transliterate(unsigned char lead, unsigned char next)
+{
+	if (lead == 0xC3) {
+		return (next >= 0x80 && next <= 0xBF) ? phalcon_str_latin1[next - 0x80] : NULL;
+	}
+
+	if (lead == 0xC4) {
+		switch (next) {
+			case 0x86: return "C";
+			case 0x87: return "c";
+			case 0x8C: return "C";
+			case 0x8D: return "c";
+			case 0x90: return "Dj";
+			case 0x91: return "dj";
+			case 0x93: return "e";
+		}
+
+		return NULL;
+	}
+
+	if (lead == 0xC5) {
+		switch (next) {
+			case 0x94: return "R";
+			case 0x95: return "r";
+			case 0xA0: return "S";
+			case 0xA1: return "s";
+			case 0xBD: return "Z";
+			case 0xBE: return "z";
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Checks if all the bytes are ASCII, in blocks of 32 (AVX2) or 16 (SSE2)
+ * bytes
+ */
+static zend_always_inline int phalcon_str_is_ascii(const unsigned char *str, size_t length)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= length; i += 32) {
+		if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *) (str + i)))) {
+			return 0;
+		}
+	}
+#elif defined(__SSE2__)
+	for (; i + 16 <= length; i += 16) {
+		if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (str + i)))) {
+			return 0;
+		}
+	}
+#endif
+
+	for (; i < length; i++) {
+		if (str[i] & 0x80) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * Returns the length of the leading run of lowercase ASCII letters and
+ * digits, which are copied as they are by the slug generation
+ */
+static zend_always_inline size_t phalcon_str_lower_alnum_span(const unsigned char *str, size_t length)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256i digit_lo = _mm256_set1_epi8('0' - 1);
+	const __m256i digit_hi = _mm256_set1_epi8('9' + 1);
+	const __m256i alpha_lo = _mm256_set1_epi8('a' - 1);
+	const __m256i alpha_hi = _mm256_set1_epi8('z' + 1);
+
+	for (; i + 32 <= length; i += 32) {
+		__m256i block = _mm256_loadu_si256((const __m256i *) (str + i));
+		__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(block, digit_lo), _mm256_cmpgt_epi8(digit_hi, block));
+		__m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(block, alpha_lo), _mm256_cmpgt_epi8(alpha_hi, block));
+		zend_ulong mask = (uint32_t) ~_mm256_movemask_epi8(_mm256_or_si256(digit, alpha));
+
+		if (mask) {
+			return i + zend_ulong_ntz(mask);
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i digit_lo = _mm_set1_epi8('0' - 1);
+	const __m128i digit_hi = _mm_set1_epi8('9' + 1);
+	const __m128i alpha_lo = _mm_set1_epi8('a' - 1);
+	const __m128i alpha_hi = _mm_set1_epi8('z' + 1);
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i block = _mm_loadu_si128((const __m128i *) (str + i));
+		__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, digit_lo), _mm_cmplt_epi8(block, digit_hi));
+		__m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(block, alpha_lo), _mm_cmplt_epi8(block, alpha_hi));
+		zend_ulong mask = (~_mm_movemask_epi8(_mm_or_si128(digit, alpha))) & 0xFFFF;
+
+		if (mask) {
+			return i + zend_ulong_ntz(mask);
+		}
+	}
+#endif
+
+	for (; i < length; i++) {
+		if (!((str[i] >= 'a' && str[i] <= 'z') || (str[i] >= '0' && str[i] <= '9'))) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+/**
+ * Builds the set of delimiters used by the case helpers, "-_" when NULL.
+ * Characters that the regular expression of the helpers does not read
+ * literally inside a character class are refused, the helpers fall back
+ * to preg_split() for them
+ */
+static int phalcon_str_delimiters(unsigned char *set, zval *delimiters)
+{
+	const unsigned char *chars = (const unsigned char *) "-_";
+	size_t length = 2, i;
+
+	memset(set, 0, 256);
+
+	if (Z_TYPE_P(delimiters) == IS_STRING) {
+		chars  = (const unsigned char *) Z_STRVAL_P(delimiters);
+		length = Z_STRLEN_P(delimiters);
+	} else if (Z_TYPE_P(delimiters) != IS_NULL) {
+		return FAILURE;
+	}
+
+	if (!length) {
+		return FAILURE;
+	}
+
+	for (i = 0; i < length; i++) {
+		switch (chars[i]) {
+			case '\0':
+			case '/':
+			case '[':
+			case '\\':
+			case ']':
+			case '^':
+				return FAILURE;
+		}
+
+		set[chars[i]] = 1;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Removes the delimiters and uppercases the first character of every part,
+ * lowercasing the rest when `lowercase` is true. Returns NULL when the text
+ * is not ASCII and must be lowercased (mb_strtolower) or the delimiters are
+ * not supported
+ */
+void phalcon_str_camelize(zval *return_value, zval *text, zval *delimiters, zval *lowercase)
+{
+	unsigned char set[256], c;
+	const unsigned char *str;
+	size_t length, i;
+	int lower, upper = 1;
+	zend_string *result;
+	char *cursor;
+
+	if (Z_TYPE_P(text) != IS_STRING || phalcon_str_delimiters(set, delimiters) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	str    = (const unsigned char *) Z_STRVAL_P(text);
+	length = Z_STRLEN_P(text);
+	lower  = zend_is_true(lowercase);
+
+	if (lower && !phalcon_str_is_ascii(str, length)) {
+		RETURN_NULL();
+	}
+
+	result = zend_string_alloc(length, 0);
+	cursor = ZSTR_VAL(result);
+
+	for (i = 0; i < length; i++) {
+		c = str[i];
+
+		if (set[c]) {
+			upper = 1;
+			continue;
+		}
+
+		if (lower) {
+			c = PHALCON_STR_LOWER(c);
+		}
+
+		if (upper) {
+			c     = PHALCON_STR_UPPER(c);
+			upper = 0;
+		}
+
+		*cursor++ = (char) c;
+	}
+
+	*cursor = '\0';
+	ZSTR_LEN(result) = cursor - ZSTR_VAL(result);
+
+	RETURN_NEW_STR(result);
+}
+
+/**
+ * Joins the parts between the delimiters with `glue` (snake and kebab case).
+ * Returns NULL when the delimiters are not supported
+ */
+void phalcon_str_delimit(zval *return_value, zval *text, zval *delimiters, zval *glue)
+{
+	unsigned char set[256];
+	const unsigned char *str;
+	size_t length, i, start;
+	int started = 0;
+	smart_str result = {0};
+
+	if (Z_TYPE_P(text) != IS_STRING || Z_TYPE_P(glue) != IS_STRING || phalcon_str_delimiters(set, delimiters) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	str    = (const unsigned char *) Z_STRVAL_P(text);
+	length = Z_STRLEN_P(text);
+	i      = 0;
+
+	while (i < length) {
+		if (set[str[i]]) {
+			i++;
+			continue;
+		}
+
+		start = i;
+		while (i < length && !set[str[i]]) {
+			i++;
+		}
+
+		if (started) {
+			smart_str_appendl(&result, Z_STRVAL_P(glue), Z_STRLEN_P(glue));
+		}
+
+		smart_str_appendl(&result, (const char *) str + start, i - start);
+		started = 1;
+	}
+
+	if (!result.s) {
+		RETURN_EMPTY_STRING();
+	}
+
+	smart_str_0(&result);
+	RETURN_STR(result.s);
+}
+
+/**
+ * Lowercases the text, adding the delimiter before every uppercase letter
+ * but the first one. Returns NULL for text or delimiters that are not ASCII
+ * (mb_strtolower) or delimiters that preg_replace() would read as a
+ * reference
+ */
+void phalcon_str_uncamelize(zval *return_value, zval *text, zval *delimiter)
+{
+	const unsigned char *str, *glue;
+	size_t length, glue_length, i, j;
+	smart_str result = {0};
+
+	if (Z_TYPE_P(text) != IS_STRING || Z_TYPE_P(delimiter) != IS_STRING) {
+		RETURN_NULL();
+	}
+
+	str         = (const unsigned char *) Z_STRVAL_P(text);
+	length      = Z_STRLEN_P(text);
+	glue        = (const unsigned char *) Z_STRVAL_P(delimiter);
+	glue_length = Z_STRLEN_P(delimiter);
+
+	if (!phalcon_str_is_ascii(str, length) || !phalcon_str_is_ascii(glue, glue_length)) {
+		RETURN_NULL();
+	}
+
+	if (memchr(glue, '\\', glue_length) || memchr(glue, '$', glue_length)) {
+		RETURN_NULL();
+	}
+
+	if (!length) {
+		RETURN_EMPTY_STRING();
+	}
+
+	smart_str_alloc(&result, length + (glue_length * 4), 0);
+
+	for (i = 0; i < length; i++) {
+		if (i > 0 && str[i] >= 'A' && str[i] <= 'Z') {
+			for (j = 0; j < glue_length; j++) {
+				smart_str_appendc(&result, PHALCON_STR_LOWER(glue[j]));
+			}
+		}
+
+		smart_str_appendc(&result, PHALCON_STR_LOWER(str[i]));
+	}
+
+	smart_str_0(&result);
+	RETURN_STR(result.s);
+}
+
+/**
+ * Reduces the runs of slashes to one, unless they follow a colon (scheme)
+ */
+void phalcon_str_reduce_slashes(zval *return_value, zval *text)
+{
+	const char *str;
+	size_t length, i = 0;
+	zend_string *result;
+	char *cursor;
+
+	if (Z_TYPE_P(text) != IS_STRING) {
+		RETURN_NULL();
+	}
+
+	str    = Z_STRVAL_P(text);
+	length = Z_STRLEN_P(text);
+
+	if (!zend_memnstr(str, "//", 2, str + length)) {
+		RETURN_STR_COPY(Z_STR_P(text));
+	}
+
+	result = zend_string_alloc(length, 0);
+	cursor = ZSTR_VAL(result);
+
+	while (i < length) {
+		if (str[i] == '/' && i + 1 < length && str[i + 1] == '/' && !(i > 0 && str[i - 1] == ':')) {
+			*cursor++ = '/';
+			i += 2;
+
+			while (i < length && str[i] == '/') {
+				i++;
+			}
+
+			continue;
+		}
+
+		*cursor++ = str[i++];
+	}
+
+	*cursor = '\0';
+	ZSTR_LEN(result) = cursor - ZSTR_VAL(result);
+
+	RETURN_NEW_STR(result);
+}
+
+/**
+ * Appends a transliterated character to a slug: the separators are
+ * collapsed and the characters that are not allowed dropped
+ */
+static zend_always_inline void phalcon_str_friendly_char(smart_str *result, unsigned char c, int lower, int *pending, zval *separator)
+{
+	switch (c) {
+		case ' ':
+		case '+':
+		case '-':
+		case '/':
+		case '_':
+		case '|':
+			*pending = 1;
+			return;
+	}
+
+	if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))) {
+		return;
+	}
+
+	if (*pending) {
+		smart_str_appendl(result, Z_STRVAL_P(separator), Z_STRLEN_P(separator));
+		*pending = 0;
+	}
+
+	smart_str_appendc(result, lower ? PHALCON_STR_LOWER(c) : c);
+}
+
+static zend_always_inline void phalcon_str_friendly_chars(smart_str *result, const char *chars, int lower, int *pending, zval *separator)
+{
+	while (*chars) {
+		phalcon_str_friendly_char(result, (unsigned char) *chars++, lower, pending, separator);
+	}
+}
+
+/**
+ * Transliterates, filters, lowercases and separates the text in one pass,
+ * with the results of Phalcon\Support\Helper\Str\Friendly without custom
+ * replacements. Returns NULL for separators that preg_replace() would read
+ * as a reference
+ */
+void phalcon_str_friendly(zval *return_value, zval *text, zval *separator, zval *lowercase)
+{
+	const unsigned char *str;
+	const char *replacement;
+	size_t length, i = 0, span;
+	int lower, pending = 0;
+	smart_str result = {0};
+	zend_string *trimmed;
+
+	if (Z_TYPE_P(text) != IS_STRING || Z_TYPE_P(separator) != IS_STRING) {
+		RETURN_NULL();
+	}
+
+	if (memchr(Z_STRVAL_P(separator), '\\', Z_STRLEN_P(separator)) || memchr(Z_STRVAL_P(separator), '$', Z_STRLEN_P(separator))) {
+		RETURN_NULL();
+	}
+
+	str    = (const unsigned char *) Z_STRVAL_P(text);
+	length = Z_STRLEN_P(text);
+	lower  = zend_is_true(lowercase);
+
+	while (i < length) {
+		span = phalcon_str_lower_alnum_span(str + i, length - i);
+		if (span) {
+			if (pending) {
+				smart_str_appendl(&result, Z_STRVAL_P(separator), Z_STRLEN_P(separator));
+				pending = 0;
+			}
+
+			smart_str_appendl(&result, (const char *) str + i, span);
+			i += span;
+			continue;
+		}
+
+		if (str[i] & 0x80) {
+			replacement = (i + 1 < length) ? phalcon_str_transliterate(str[i], str[i + 1]) : NULL;
+			if (replacement) {
+				phalcon_str_friendly_chars(&result, replacement, lower, &pending, separator);
+				i += 2;
+			} else {
+				i++;
+			}
+
+			continue;
+		}
+
+		switch (str[i]) {
+			case '\'':
+				i++;
+				continue;
+
+			case '&':
+				phalcon_str_friendly_chars(&result, " and ", lower, &pending, separator);
+				i++;
+				continue;
+
+			case '\r':
+				if (i + 1 < length && str[i + 1] == '\n') {
+					phalcon_str_friendly_chars(&result, " ", lower, &pending, separator);
+					i += 2;
+					continue;
+				}
+				break;
+
+			case '\n':
+				phalcon_str_friendly_chars(&result, " ", lower, &pending, separator);
+				i++;
+				continue;
+		}
+
+		phalcon_str_friendly_char(&result, str[i], lower, &pending, separator);
+		i++;
+	}
+
+	if (pending) {
+		smart_str_appendl(&result, Z_STRVAL_P(separator), Z_STRLEN_P(separator));
+	}
+
+	if (!result.s) {
+		RETURN_EMPTY_STRING();
+	}
+
+	smart_str_0(&result);
+
+	trimmed = php_trim(result.s, Z_STRVAL_P(separator), Z_STRLEN_P(separator), 3);
+	smart_str_free(&result);
+
+	RETURN_STR(trimmed);
+}
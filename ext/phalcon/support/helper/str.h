@@ -0,0 +1,23 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_SUPPORT_HELPER_STR_H
+#define PHALCON_SUPPORT_HELPER_STR_H
+
+#include <Zend/zend.h>
+
+/* Case conversion, separators and transliteration */
+void phalcon_str_camelize(zval *return_value, zval *text, zval *delimiters, zval *lowercase);
+void phalcon_str_delimit(zval *return_value, zval *text, zval *delimiters, zval *glue);
+void phalcon_str_uncamelize(zval *return_value, zval *text, zval *delimiter);
+void phalcon_str_reduce_slashes(zval *return_value, zval *text);
+void phalcon_str_friendly(zval *return_value, zval *text, zval *separator, zval *lowercase);
+
+#endif /* PHALCON_SUPPORT_HELPER_STR_H */
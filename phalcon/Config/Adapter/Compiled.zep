@@ -0,0 +1,162 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Config\Adapter;
+
+use Phalcon\Config\Compiler;
+use Phalcon\Config\Config;
+use Phalcon\Config\Exception;
+
+/**
+ * Reads a configuration compiled by `Phalcon\Config\Compiler`. The values
+ * are already merged and cast, and `path()` reads them from the index of
+ * the dotted paths instead of traversing the nested objects.
+ *
+ * When `sources` are passed, the configuration is compiled again if it is
+ * older than one of their files. The index is dropped once the configuration
+ * is changed through this object, with `set()`, `remove()`, `merge()` or
+ * `clear()`. Changes made on the nested objects are not tracked: after
+ * `$config->database->host = "x"`, `path("database.host")` still returns the
+ * compiled value. Change nested values through `merge()` instead.
+ *
+ * ```php
+ * use Phalcon\Config\Adapter\Compiled;
+ *
+ * $config = new Compiled(
+ *     "/app/cache/config.php",
+ *     [
+ *         "/app/config/config.ini",
+ *         "/app/config/config.local.yml",
+ *     ],
+ *     ""
+ * );
+ *
+ * echo $config->path("database.host");
+ * ```
+ */
+class Compiled extends Config
+{
+    /**
+     * @var array
+     */
+    protected index = [];
+
+    /**
+     * Phalcon\Config\Adapter\Compiled constructor
+     *
+     * @param string $filePath
+     * @param array  $sources
+     * @param string $defaultAdapter
+     *
+     * @throws Exception
+     */
+    public function __construct(
+        string! filePath,
+        array sources = [],
+        string! defaultAdapter = "php"
+    ) {
+        var compiled, compiler, data, index;
+
+        if !empty sources {
+            let compiler = new Compiler();
+
+            if compiler->isStale(sources, filePath) {
+                compiler->compile(sources, filePath, defaultAdapter);
+            }
+        }
+
+        if unlikely !file_exists(filePath) {
+            throw new Exception(
+                "Error opening configuration file '" . filePath . "'"
+            );
+        }
+
+        let compiled = require filePath;
+
+        if unlikely typeof compiled !== "array" || !fetch data, compiled["config"] || !fetch index, compiled["index"] {
+            throw new Exception(
+                "The file '" . filePath . "' is not a compiled configuration"
+            );
+        }
+
+        parent::__construct(data);
+
+        let this->index = index;
+    }
+
+    /**
+     * Clears the internal collection
+     */
+    public function clear() -> void
+    {
+        let this->index = [];
+
+        parent::clear();
+    }
+
+    /**
+     * Returns a value from current config using a dot separated path.
+     *
+     *```php
+     * echo $config->path("unknown.path", "default", ".");
+     *```
+     *
+     * @param string      $path
+     * @param mixed|null  $defaultValue
+     * @param string|null $delimiter
+     *
+     * @return mixed
+     */
+    public function path(
+        string path,
+        var defaultValue = null,
+        string delimiter = null
+    ) -> var {
+        var value;
+
+        if empty delimiter {
+            let delimiter = this->pathDelimiter;
+        }
+
+        if (
+            delimiter === self::DEFAULT_PATH_DELIMITER &&
+            fetch value, this->index[path]
+        ) {
+            return value;
+        }
+
+        return parent::path(path, defaultValue, delimiter);
+    }
+
+    /**
+     * Delete the element from the collection
+     *
+     * @param string $element
+     */
+    public function remove(string element) -> void
+    {
+        let this->index = [];
+
+        parent::remove(element);
+    }
+
+    /**
+     * Set an element in the collection
+     *
+     * @param string $element
+     * @param mixed  $value
+     */
+    public function set(string element, var value) -> void
+    {
+        let this->index = [];
+
+        parent::set(element, value);
+    }
+}
@@ -0,0 +1,184 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Config;
+
+use Phalcon\Config\Adapter\Grouped;
+
+/**
+ * Phalcon\Config\Compiler
+ *
+ * Merges the sources of a `Phalcon\Config\Adapter\Grouped` configuration
+ * once and writes the result in a PHP file that returns it as an array
+ * literal. Included files are kept in opcache, so the INI, JSON and YAML
+ * files are neither parsed nor cast and merged on every request.
+ *
+ * The file also holds an index of the dotted paths of every value, which is
+ * read by `Phalcon\Config\Adapter\Compiled::path()`.
+ *
+ * ```php
+ * use Phalcon\Config\Compiler;
+ *
+ * $compiler = new Compiler();
+ *
+ * $compiler->compile(
+ *     [
+ *         "/app/config/config.ini",
+ *         "/app/config/config.local.yml",
+ *     ],
+ *     "/app/cache/config.php",
+ *     ""
+ * );
+ * ```
+ */
+class Compiler
+{
+    /**
+     * Compiles the sources into `target` and returns the number of indexed
+     * paths
+     *
+     * @param array  $sources
+     * @param string $target
+     * @param string $defaultAdapter
+     *
+     * @return int
+     * @throws Exception
+     */
+    public function compile(
+        array! sources,
+        string! target,
+        string! defaultAdapter = "php"
+    ) -> int {
+        var config, data, index, path, temporary, value;
+
+        let config = new Grouped(sources, defaultAdapter),
+            data   = config->toArray(),
+            index  = [];
+
+        /**
+         * The values are returned by path() itself, so that keys holding the
+         * delimiter resolve the same way as they do without the index
+         */
+        for path in this->collectPaths(data) {
+            let value = config->path(path);
+
+            if typeof value !== "object" {
+                let index[path] = value;
+            }
+        }
+
+        /**
+         * Write a temporary file and rename it, so that a request never
+         * includes a partial configuration
+         */
+        let temporary = target . "." . uniqid() . ".tmp";
+
+        if unlikely file_put_contents(
+            temporary,
+            "<?php\n\nreturn " . var_export(
+                [
+                    "config" : data,
+                    "index"  : index
+                ],
+                true
+            ) . ";\n"
+        ) === false {
+            throw new Exception(
+                "The configuration file '" . target . "' cannot be written"
+            );
+        }
+
+        if unlikely !rename(temporary, target) {
+            unlink(temporary);
+
+            throw new Exception(
+                "The configuration file '" . target . "' cannot be written"
+            );
+        }
+
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(target, true);
+        }
+
+        return count(index);
+    }
+
+    /**
+     * Checks if the configuration `target` is older than one of the files in
+     * the sources
+     *
+     * @param array  $sources
+     * @param string $target
+     *
+     * @return bool
+     */
+    public function isStale(array! sources, string! target) -> bool
+    {
+        var compiled, file, source;
+
+        if !file_exists(target) {
+            return true;
+        }
+
+        let compiled = filemtime(target);
+
+        for source in sources {
+            if typeof source === "string" {
+                let file = source;
+            } elseif typeof source === "array" && isset source["filePath"] {
+                let file = source["filePath"];
+            } else {
+                continue;
+            }
+
+            if file_exists(file) && filemtime(file) > compiled {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Returns the dotted paths of the values that are not arrays
+     *
+     * @param array  $data
+     * @param string $prefix
+     *
+     * @return array
+     */
+    protected function collectPaths(array data, string prefix = "") -> array
+    {
+        var key, path, value;
+        array paths;
+
+        let paths = [];
+
+        for key, value in data {
+            let path = prefix . key;
+
+            if typeof value === "array" {
+                let paths = array_merge(
+                    paths,
+                    this->collectPaths(
+                        value,
+                        path . Config::DEFAULT_PATH_DELIMITER
+                    )
+                );
+
+                continue;
+            }
+
+            let paths[] = path;
+        }
+
+        return paths;
+    }
+}
@@ -46,7 +46,8 @@ class ConfigFactory extends AbstractFactory
      *                                    'adapter'   => 'ini',
      *                                    'filePath'  => 'config.ini',
      *                                    'mode'      => null,
-     *                                    'callbacks' => null
+     *                                    'callbacks' => null,
+     *                                    'sources'   => null
      *                                    ]
      *
      * @return ConfigInterface
@@ -60,8 +61,15 @@ class ConfigFactory extends AbstractFactory
             adapter     = strtolower(configArray["adapter"]),
             filePath    = configArray["filePath"];
 
+        /**
+         * Compiled configurations are PHP files
+         */
         if true === empty(pathinfo(filePath, PATHINFO_EXTENSION)) {
-            let filePath .= "." . lcfirst(adapter);
+            if adapter === "compiled" {
+                let filePath .= ".php";
+            } else {
+                let filePath .= "." . lcfirst(adapter);
+            }
         }
 
         switch (adapter) {
@@ -78,6 +86,13 @@ class ConfigFactory extends AbstractFactory
                     let param = configArray["callbacks"];
                 }
                 return this->newInstance(adapter, filePath, param);
+
+            case "compiled":
+                let param = null;
+                if isset configArray["sources"] {
+                    let param = configArray["sources"];
+                }
+                return this->newInstance(adapter, filePath, param);
         }
 
         return this->newInstance(adapter, filePath);
@@ -105,6 +120,7 @@ class ConfigFactory extends AbstractFactory
             arguments  = [fileName];
 
         switch (name) {
+            case "compiled":
             case "grouped":
             case "ini":
             case "yaml":
@@ -133,11 +149,12 @@ class ConfigFactory extends AbstractFactory
     protected function getServices() -> array
     {
         return [
-            "grouped" : "Phalcon\\Config\\Adapter\\Grouped",
-            "ini"     : "Phalcon\\Config\\Adapter\\Ini",
-            "json"    : "Phalcon\\Config\\Adapter\\Json",
-            "php"     : "Phalcon\\Config\\Adapter\\Php",
-            "yaml"    : "Phalcon\\Config\\Adapter\\Yaml"
+            "compiled" : "Phalcon\\Config\\Adapter\\Compiled",
+            "grouped"  : "Phalcon\\Config\\Adapter\\Grouped",
+            "ini"      : "Phalcon\\Config\\Adapter\\Ini",
+            "json"     : "Phalcon\\Config\\Adapter\\Json",
+            "php"      : "Phalcon\\Config\\Adapter\\Php",
+            "yaml"     : "Phalcon\\Config\\Adapter\\Yaml"
         ];
     }
 
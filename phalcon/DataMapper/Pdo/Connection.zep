@@ -143,7 +143,8 @@ class Connection extends AbstractConnection
     {
         this->profiler->start(__FUNCTION__);
 
-        let this->pdo = null;
+        let this->pdo        = null,
+            this->statements = [];
 
         this->profiler->finish();
     }
@@ -17,7 +17,9 @@ namespace Phalcon\DataMapper\Pdo\Connection;
 
 use BadMethodCallException;
 use Phalcon\DataMapper\Pdo\Exception\CannotBindValue;
+use Phalcon\DataMapper\Pdo\Profiler\Profiler;
 use Phalcon\DataMapper\Pdo\Profiler\ProfilerInterface;
+use Throwable;
 
 /**
  * Provides array quoting, profiling, a new `perform()` method, new `fetch*()`
@@ -25,6 +27,13 @@ use Phalcon\DataMapper\Pdo\Profiler\ProfilerInterface;
  */
 abstract class AbstractConnection implements ConnectionInterface
 {
+    /**
+     * Notified after every statement, see `setListener()`
+     *
+     * @var callable|null
+     */
+    protected listener = null;
+
     /**
      * @var \PDO
      */
@@ -35,6 +44,21 @@ abstract class AbstractConnection implements ConnectionInterface
      */
     protected profiler;
 
+    /**
+     * Maximum number of prepared statements kept by `perform()`; 0 disables
+     * the cache
+     *
+     * @var int
+     */
+    protected statementCacheSize = 0;
+
+    /**
+     * Prepared statements keyed by SQL, least recently used first
+     *
+     * @var array
+     */
+    protected statements = [];
+
     /**
      * Proxies to PDO methods created for specific drivers; in particular,
      * `sqlite` and `pgsql`.
@@ -88,6 +112,14 @@ abstract class AbstractConnection implements ConnectionInterface
         return result;
     }
 
+    /**
+     * Removes the prepared statements kept by `perform()`
+     */
+    public function clearStatements() -> void
+    {
+        let this->statements = [];
+    }
+
     /**
      * Commits the existing transaction. If the profiler is enabled, the
      * operation will be recorded.
@@ -152,14 +184,21 @@ abstract class AbstractConnection implements ConnectionInterface
      */
     public function exec(string statement) -> int
     {
-        var affectedRows;
+        var affectedRows, ex;
 
         this->connect();
         this->profiler->start(__FUNCTION__);
 
-        let affectedRows = this->pdo->exec(statement);
+        try {
+            let affectedRows = this->pdo->exec(statement);
+        } catch Throwable, ex {
+            this->notifyListener(statement, ex);
+
+            throw ex;
+        }
 
         this->profiler->finish(statement);
+        this->notifyListener(statement);
 
         return affectedRows;
     }
@@ -328,11 +367,12 @@ abstract class AbstractConnection implements ConnectionInterface
         string className = "stdClass",
         array arguments = []
     ) -> array {
-        var sth;
-
-        let sth = this->perform(statement, values);
-
-        return sth->fetchAll(\PDO::FETCH_CLASS, className, arguments);
+        return this->fetchData(
+            "fetchAll",
+            [\PDO::FETCH_CLASS, className, arguments],
+            statement,
+            values
+        );
     }
 
     /**
@@ -496,6 +536,16 @@ abstract class AbstractConnection implements ConnectionInterface
         return quotes;
     }
 
+    /**
+     * Returns the maximum number of prepared statements kept by `perform()`
+     *
+     * @return int
+     */
+    public function getStatementCacheSize() -> int
+    {
+        return this->statementCacheSize;
+    }
+
     /**
      * Is a transaction currently active? If the profiler is enabled, the
      * operation will be recorded. If the profiler is enabled, the operation
@@ -556,6 +606,10 @@ abstract class AbstractConnection implements ConnectionInterface
      * respective placeholders will be replaced in the query string. If the
      * profiler is enabled, the operation will be recorded.
      *
+     * When the statement cache is enabled, the statement prepared for the same
+     * SQL is reused; its cursor is closed, so a statement returned earlier for
+     * that SQL must not be read anymore.
+     *
      * @param string $statement
      * @param array  $values
      *
@@ -565,18 +619,13 @@ abstract class AbstractConnection implements ConnectionInterface
         string statement,
         array values = []
     ) -> <\PDOStatement> {
-        var name, sth, value;
+        var sth;
 
         this->connect();
 
         this->profiler->start(__FUNCTION__);
 
-        let sth = this->prepare(statement);
-        for name, value in values {
-            this->performBind(sth, name, value);
-        }
-
-        sth->execute();
+        let sth = this->performStatement(statement, values, true);
 
         this->profiler->finish(statement, values);
 
@@ -709,6 +758,22 @@ abstract class AbstractConnection implements ConnectionInterface
         return this->pdo->setAttribute(attribute, value);
     }
 
+    /**
+     * Sets a callable notified after every statement performed or executed
+     * with `listener(connection, statement, exception)`; the exception is
+     * `null` when the statement succeeded. `null` removes it
+     *
+     * @param callable|null $listener
+     *
+     * @return ConnectionInterface
+     */
+    public function setListener(var listener) -> <ConnectionInterface>
+    {
+        let this->listener = listener;
+
+        return this;
+    }
+
     /**
      * Sets the Profiler instance.
      *
@@ -719,6 +784,62 @@ abstract class AbstractConnection implements ConnectionInterface
         let this->profiler = profiler;
     }
 
+    /**
+     * Sets the maximum number of prepared statements kept by `perform()`. The
+     * least recently used statements are removed first; 0 disables the cache
+     *
+     * @param int $size
+     *
+     * @return ConnectionInterface
+     */
+    public function setStatementCacheSize(int size) -> <ConnectionInterface>
+    {
+        let this->statementCacheSize = max(0, size);
+
+        if count(this->statements) > this->statementCacheSize {
+            let this->statements = array_slice(
+                this->statements,
+                count(this->statements) - this->statementCacheSize,
+                null,
+                true
+            );
+        }
+
+        return this;
+    }
+
+    /**
+     * Performs a statement and returns an iterator over the rows as
+     * associative arrays. The rows are fetched in batches of `batchSize`, so
+     * large results can be processed without loading them at once.
+     *
+     * The statement is not taken from the statement cache; it belongs to the
+     * iterator until the last row has been read.
+     *
+     * @param string $statement
+     * @param array  $values
+     * @param int    $batchSize
+     *
+     * @return BatchIterator
+     */
+    public function yieldAll(
+        string statement,
+        array values = [],
+        int batchSize = 100
+    ) -> <BatchIterator> {
+        var sth;
+
+        this->connect();
+
+        this->profiler->start(__FUNCTION__);
+
+        let sth = this->performStatement(statement, values, false);
+
+        this->profiler->finish(statement, values);
+
+        return new BatchIterator(sth, batchSize);
+    }
+
     /**
      * Bind a value using the proper PDO::PARAM_* type.
      *
@@ -781,7 +902,11 @@ abstract class AbstractConnection implements ConnectionInterface
     ) -> array {
         var result, sth;
 
-        let sth    = this->perform(statement, values),
+        this->connect();
+
+        this->profiler->start("perform");
+
+        let sth    = this->performStatement(statement, values, true),
             result = call_user_func_array(
                 [
                     sth,
@@ -790,6 +915,9 @@ abstract class AbstractConnection implements ConnectionInterface
                 arguments
             );
 
+        this->profilerMark("fetch");
+        this->profiler->finish(statement, values);
+
         /**
          * If this returns boolean or anything other than an array, return
          * an empty array back
@@ -800,4 +928,109 @@ abstract class AbstractConnection implements ConnectionInterface
 
         return result;
     }
+
+    /**
+     * Calls the listener, if any
+     *
+     * @param string         $statement
+     * @param Throwable|null $exception
+     */
+    protected function notifyListener(
+        string statement,
+        <Throwable> exception = null
+    ) -> void {
+        if this->listener !== null {
+            call_user_func(this->listener, this, statement, exception);
+        }
+    }
+
+    /**
+     * Prepares (or reuses) a statement, binds the values and executes it
+     *
+     * @param string $statement
+     * @param array  $values
+     * @param bool   $cached
+     *
+     * @return \PDOStatement
+     */
+    protected function performStatement(
+        string statement,
+        array values,
+        bool cached
+    ) -> <\PDOStatement> {
+        var ex, name, sth, value;
+
+        try {
+            if cached {
+                let sth = this->prepareStatement(statement);
+            } else {
+                let sth = this->pdo->prepare(statement);
+            }
+
+            this->profilerMark("prepare");
+
+            for name, value in values {
+                this->performBind(sth, name, value);
+            }
+
+            sth->execute();
+        } catch Throwable, ex {
+            this->notifyListener(statement, ex);
+
+            throw ex;
+        }
+
+        this->profilerMark("execute");
+        this->notifyListener(statement);
+
+        return sth;
+    }
+
+    /**
+     * Returns the prepared statement for the SQL, from the statement cache if
+     * it is enabled
+     *
+     * @param string $statement
+     *
+     * @return \PDOStatement
+     */
+    protected function prepareStatement(string statement) -> <\PDOStatement>
+    {
+        var sth;
+
+        if this->statementCacheSize < 1 {
+            return this->pdo->prepare(statement);
+        }
+
+        if fetch sth, this->statements[statement] {
+            /**
+             * Move it to the end, it is the most recently used
+             */
+            unset this->statements[statement];
+
+            sth->closeCursor();
+        } else {
+            let sth = this->pdo->prepare(statement);
+
+            if count(this->statements) >= this->statementCacheSize {
+                unset this->statements[array_key_first(this->statements)];
+            }
+        }
+
+        let this->statements[statement] = sth;
+
+        return sth;
+    }
+
+    /**
+     * Records the time of a phase of the current profile entry
+     *
+     * @param string $phase
+     */
+    protected function profilerMark(string phase) -> void
+    {
+        if this->profiler instanceof Profiler {
+            this->profiler->mark(phase);
+        }
+    }
 }
@@ -0,0 +1,163 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\DataMapper\Pdo\Connection;
+
+use Iterator;
+use Phalcon\DataMapper\Pdo\Exception\Exception;
+
+/**
+ * Iterates over the rows of an executed statement as associative arrays,
+ * fetching them from the statement in batches of `batchSize` rows. Only the
+ * current batch is kept in memory.
+ *
+ * The rows can be traversed only once; the cursor of the statement is closed
+ * after the last row.
+ */
+class BatchIterator implements Iterator
+{
+    /**
+     * @var array
+     */
+    protected batch = [];
+
+    /**
+     * @var int
+     */
+    protected batchSize = 100;
+
+    /**
+     * @var bool
+     */
+    protected done = false;
+
+    /**
+     * @var int
+     */
+    protected key = 0;
+
+    /**
+     * @var int
+     */
+    protected position = 0;
+
+    /**
+     * @var \PDOStatement
+     */
+    protected statement;
+
+    /**
+     * Constructor.
+     *
+     * @param \PDOStatement $statement
+     * @param int           $batchSize
+     */
+    public function __construct(<\PDOStatement> statement, int batchSize = 100)
+    {
+        let this->statement = statement,
+            this->batchSize = max(1, batchSize);
+    }
+
+    /**
+     * Returns the current row
+     *
+     * @return array|null
+     */
+    public function current() -> array | null
+    {
+        var row;
+
+        if !fetch row, this->batch[this->position] {
+            return null;
+        }
+
+        return row;
+    }
+
+    /**
+     * Returns the number of the current row
+     *
+     * @return int
+     */
+    public function key() -> int
+    {
+        return this->key;
+    }
+
+    /**
+     * Moves to the next row, fetching the next batch when needed
+     */
+    public function next() -> void
+    {
+        let this->position++,
+            this->key++;
+
+        if this->position >= count(this->batch) {
+            this->load();
+        }
+    }
+
+    /**
+     * Fetches the first batch. The rows cannot be traversed again
+     *
+     * @throws Exception
+     */
+    public function rewind() -> void
+    {
+        if unlikely this->key > 0 {
+            throw new Exception("The rows of a statement can be traversed only once");
+        }
+
+        if !this->done && empty this->batch {
+            this->load();
+        }
+    }
+
+    /**
+     * Checks if there is a current row
+     *
+     * @return bool
+     */
+    public function valid() -> bool
+    {
+        return isset this->batch[this->position];
+    }
+
+    /**
+     * Fetches the next batch of rows
+     */
+    protected function load() -> void
+    {
+        var row;
+        int counter = 0;
+
+        let this->batch    = [],
+            this->position = 0;
+
+        if this->done {
+            return;
+        }
+
+        while counter < this->batchSize {
+            let row = this->statement->$fetch(\PDO::FETCH_ASSOC);
+
+            if row === false {
+                let this->done = true;
+
+                this->statement->closeCursor();
+
+                break;
+            }
+
+            let this->batch[] = row,
+                counter++;
+        }
+    }
+}
@@ -15,14 +15,85 @@
 
 namespace Phalcon\DataMapper\Pdo;
 
+use Phalcon\DataMapper\Pdo\Connection\AbstractConnection;
 use Phalcon\DataMapper\Pdo\Connection\ConnectionInterface;
 use Phalcon\DataMapper\Pdo\Exception\ConnectionNotFound;
+use Phalcon\Di\ResettableInterface;
+use Throwable;
 
 /**
  * Manages Connection instances for default, read, and write connections.
+ *
+ * When no name is requested, a connection is picked at random according to
+ * the weights passed to `setRead()`/`setWrite()`. The picked connection is
+ * connected first; a connection that cannot connect, or whose statements fail
+ * with a connection error, is skipped for an exponentially growing delay
+ * (`setBackoff()`). A replication lag probe can be set with `setLagProbe()`
+ * to skip the read connections lagging behind. When no connection is
+ * available the master is returned.
+ *
+ * With `setSticky()`, the first write statement performed makes `getRead()`
+ * return the connection that performed it until `unpin()` is called, e.g. at
+ * the end of the request.
+ *
+ * ```php
+ * $locator = new ConnectionLocator($master);
+ *
+ * $locator
+ *     ->setRead("replica1", $factory1, 3)
+ *     ->setRead("replica2", $factory2)
+ *     ->setLagProbe(
+ *         function ($connection) {
+ *             return $connection->fetchOne("SHOW REPLICA STATUS")["Seconds_Behind_Source"];
+ *         },
+ *         2.0
+ *     )
+ *     ->setSticky();
+ * ```
  */
-class ConnectionLocator implements ConnectionLocatorInterface
+class ConnectionLocator implements ConnectionLocatorInterface, ResettableInterface
 {
+    /**
+     * Delay in seconds before a failed connection is tried again, doubled on
+     * every consecutive failure
+     *
+     * @var float
+     */
+    protected backoff = 1.0;
+
+    /**
+     * Consecutive failures, keyed by "type-name"
+     *
+     * @var array
+     */
+    protected failures = [];
+
+    /**
+     * Time of the last lag probe, keyed by "type-name"
+     *
+     * @var array
+     */
+    protected lagChecks = [];
+
+    /**
+     * Seconds between two lag probes of the same connection
+     *
+     * @var float
+     */
+    protected lagInterval = 1.0;
+
+    /**
+     * @var callable|null
+     */
+    protected lagProbe = null;
+
+    /**
+     * Maximum lag in seconds
+     *
+     * @var float
+     */
+    protected lagThreshold = 1.0;
+
     /**
      * A default Connection connection factory/instance.
      *
@@ -30,6 +101,20 @@ class ConnectionLocator implements ConnectionLocatorInterface
      */
     protected master;
 
+    /**
+     * Maximum delay in seconds before a failed connection is tried again
+     *
+     * @var float
+     */
+    protected maxBackoff = 60.0;
+
+    /**
+     * The connection that performed a write, returned by `getRead()`
+     *
+     * @var ConnectionInterface|null
+     */
+    protected pinned = null;
+
     /**
      * A registry of Connection "read" factories/instances.
      *
@@ -37,6 +122,25 @@ class ConnectionLocator implements ConnectionLocatorInterface
      */
     protected read = [];
 
+    /**
+     * Time a failed connection can be tried again, keyed by "type-name"
+     *
+     * @var array
+     */
+    protected retryAt = [];
+
+    /**
+     * @var bool
+     */
+    protected sticky = false;
+
+    /**
+     * Weights of the connections, keyed by type and name
+     *
+     * @var array
+     */
+    protected weights = [];
+
     /**
      * A registry of Connection "write" factories/instances.
      *
@@ -88,8 +192,8 @@ class ConnectionLocator implements ConnectionLocatorInterface
 
     /**
      * Returns a read connection by name; if no name is given, picks a
-     * random connection; if no read connections are present, returns the
-     * default connection.
+     * random healthy connection, or the connection pinned by a write; if no
+     * read connections are available, returns the default connection.
      *
      * @param string $name
      *
@@ -103,8 +207,8 @@ class ConnectionLocator implements ConnectionLocatorInterface
 
     /**
      * Returns a write connection by name; if no name is given, picks a
-     * random connection; if no write connections are present, returns the
-     * default connection.
+     * random healthy connection; if no write connections are available,
+     * returns the default connection.
      *
      * @param string $name
      *
@@ -116,6 +220,136 @@ class ConnectionLocator implements ConnectionLocatorInterface
         return this->getConnection("write", name);
     }
 
+    /**
+     * Returns true if the reads are pinned to the connection that performed
+     * a write
+     *
+     * @return bool
+     */
+    public function isPinned() -> bool
+    {
+        return this->pinned !== null;
+    }
+
+    /**
+     * Marks a connection as failed; it is skipped by the random selection
+     * until its backoff delay has passed
+     *
+     * @param string $type "read" or "write"
+     * @param string $name
+     *
+     * @return ConnectionLocatorInterface
+     */
+    public function markFailed(string type, string name) -> <ConnectionLocatorInterface>
+    {
+        var failures, key;
+        float delay;
+
+        let key = type . "-" . name;
+
+        if !fetch failures, this->failures[key] {
+            let failures = 0;
+        }
+
+        let failures++,
+            delay = min(
+                this->maxBackoff,
+                this->backoff * pow(2, failures - 1)
+            );
+
+        let this->failures[key] = failures,
+            this->retryAt[key]  = microtime(true) + delay;
+
+        return this;
+    }
+
+    /**
+     * Called by the connections resolved by the locator after every
+     * statement. Connection errors mark the connection as failed, write
+     * statements pin the reads to the connection when sticky
+     *
+     * @param ConnectionInterface $connection
+     * @param string              $statement
+     * @param Throwable|null      $exception
+     */
+    public function notify(
+        <ConnectionInterface> connection,
+        string statement,
+        <Throwable> exception = null
+    ) -> void {
+        var key, parts;
+
+        if exception !== null {
+            if this->isConnectionError(exception) {
+                let key = array_search(connection, this->instances, true);
+
+                if key !== false {
+                    let parts = explode("-", key, 2);
+
+                    this->markFailed(parts[0], parts[1]);
+                }
+            }
+
+            return;
+        }
+
+        if this->sticky && this->pinned === null && this->isWrite(statement) {
+            let this->pinned = connection;
+        }
+    }
+
+    /**
+     * Releases the reads pinned by a write of the last request
+     */
+    public function resetRequest() -> void
+    {
+        this->unpin();
+    }
+
+    /**
+     * Sets the delay in seconds before a failed connection is tried again;
+     * it doubles on every consecutive failure, up to `maximum`
+     *
+     * @param float $backoff
+     * @param float $maximum
+     *
+     * @return ConnectionLocatorInterface
+     */
+    public function setBackoff(
+        float backoff,
+        float maximum = 60.0
+    ) -> <ConnectionLocatorInterface> {
+        let this->backoff    = backoff,
+            this->maxBackoff = maximum;
+
+        return this;
+    }
+
+    /**
+     * Sets a callable returning the replication lag in seconds of a read
+     * connection, `probe(connection)`. Connections lagging more than
+     * `threshold`, or for which the probe returns `null`, are skipped. The
+     * probe runs at most once every `interval` seconds per connection
+     *
+     * @param callable|null $probe
+     * @param float         $threshold
+     * @param float         $interval
+     *
+     * @return ConnectionLocatorInterface
+     */
+    public function setLagProbe(
+        var probe,
+        float threshold = 1.0,
+        float interval = 1.0
+    ) -> <ConnectionLocatorInterface> {
+        let this->lagProbe     = probe,
+            this->lagThreshold = threshold,
+            this->lagInterval  = interval,
+            this->lagChecks    = [];
+
+        return this;
+    }
+
     /**
      * Sets the default connection factory.
      *
@@ -127,39 +361,80 @@ class ConnectionLocator implements ConnectionLocatorInterface
     {
         let this->master = callableObject;
 
+        this->listen(callableObject);
+
         return this;
     }
 
     /**
-     * Sets a read connection factory by name.
+     * Sets a read connection factory by name. The weight is the relative
+     * chance of the connection to be picked, 0 only allows it by name
      *
      * @param string   $name
      * @param callable $callable
+     * @param int      $weight
      *
      * @return ConnectionLocatorInterface
      */
     public function setRead(
         string name,
-        callable callableObject
+        callable callableObject,
+        int weight = 1
     ) -> <ConnectionLocatorInterface> {
-        let this->read[name] = callableObject;
+        let this->read[name]            = callableObject,
+            this->weights["read"][name] = weight;
 
         return this;
     }
 
     /**
-     * Sets a write connection factory by name.
+     * Sets a write connection factory by name. The weight is the relative
+     * chance of the connection to be picked, 0 only allows it by name
      *
      * @param string   $name
      * @param callable $callable
+     * @param int      $weight
      *
      * @return ConnectionLocatorInterface
      */
     public function setWrite(
         string name,
-        callable callableObject
+        callable callableObject,
+        int weight = 1
     ) -> <ConnectionLocatorInterface> {
-        let this->write[name] = callableObject;
+        let this->write[name]            = callableObject,
+            this->weights["write"][name] = weight;
+
+        return this;
+    }
+
+    /**
+     * Pins the reads to the connection that performed the first write
+     * statement, until `unpin()` is called
+     *
+     * @param bool $sticky
+     *
+     * @return ConnectionLocatorInterface
+     */
+    public function setSticky(bool sticky = true) -> <ConnectionLocatorInterface>
+    {
+        let this->sticky = sticky;
+
+        if !sticky {
+            let this->pinned = null;
+        }
+
+        return this;
+    }
+
+    /**
+     * Releases the reads pinned by a write, e.g. at the end of the request
+     *
+     * @return ConnectionLocatorInterface
+     */
+    public function unpin() -> <ConnectionLocatorInterface>
+    {
+        let this->pinned = null;
 
         return this;
     }
@@ -177,11 +452,9 @@ class ConnectionLocator implements ConnectionLocatorInterface
         string type,
         string name = ""
     ) -> <ConnectionInterface> {
-        var collection, instanceName, instances, requested;
+        var candidates, collection, connection, requested;
 
-        let collection = this->{type},
-            requested  = name,
-            instances  = this->instances;
+        let collection = this->{type};
 
         /**
          * No collection returns the master
@@ -190,32 +463,260 @@ class ConnectionLocator implements ConnectionLocatorInterface
             return this->getMaster();
         }
 
-        /**
-         * If the requested name is empty, get a random connection
-         */
-        if "" === requested {
-            let requested = array_rand(collection);
+        if "" !== name {
+            /**
+             * If the connection name does not exist, send an exception back
+             */
+            if !isset collection[name] {
+                throw new ConnectionNotFound(
+                    "Connection not found: " . type . ":" . name
+                );
+            }
+
+            return this->resolve(type, name);
+        }
+
+        if "read" === type && this->pinned !== null {
+            return this->pinned;
         }
 
         /**
-         * If the connection name does not exist, send an exception back
+         * Pick among the healthy connections according to their weights
          */
-        if !isset collection[requested] {
-            throw new ConnectionNotFound(
-                "Connection not found: " . type . ":" . requested
-            );
+        let candidates = this->getCandidates(type);
+
+        while !empty candidates {
+            let requested = this->pick(candidates);
+
+            unset candidates[requested];
+
+            let connection = this->resolve(type, requested);
+
+            if this->isAvailable(type, requested, connection) {
+                return connection;
+            }
+        }
+
+        return this->getMaster();
+    }
+
+    /**
+     * Returns the weights of the connections that are not waiting for their
+     * backoff delay, keyed by name
+     *
+     * @param string $type
+     *
+     * @return array
+     */
+    protected function getCandidates(string type) -> array
+    {
+        var callableObject, name, retryAt, weight;
+        array candidates;
+        float now;
+
+        let candidates = [],
+            now        = microtime(true);
+
+        for name, callableObject in this->{type} {
+            if !fetch weight, this->weights[type][name] {
+                let weight = 1;
+            }
+
+            if weight < 1 {
+                continue;
+            }
+
+            if fetch retryAt, this->retryAt[type . "-" . name] {
+                if retryAt > now {
+                    continue;
+                }
+            }
+
+            let candidates[name] = weight;
+        }
+
+        return candidates;
+    }
+
+    /**
+     * Connects the picked connection and probes its lag. A connection that
+     * cannot connect is marked as failed
+     *
+     * @param string              $type
+     * @param string              $name
+     * @param ConnectionInterface $connection
+     *
+     * @return bool
+     */
+    protected function isAvailable(
+        string type,
+        string name,
+        <ConnectionInterface> connection
+    ) -> bool {
+        var checked, ex, key, lag;
+        float now;
+
+        let key = type . "-" . name;
+
+        try {
+            connection->connect();
+        } catch Throwable, ex {
+            this->markFailed(type, name);
+
+            return false;
         }
 
         /**
-         * Check if the connection has been resolved already, if yes return
-         * it, otherwise resolve it. The keys in the `resolved` array are
-         * formatted as "type-name"
+         * Connected, close the circuit
          */
-        let instanceName = type . "-" . requested;
+        unset this->failures[key];
+        unset this->retryAt[key];
+
+        if "read" !== type || this->lagProbe === null {
+            return true;
+        }
+
+        let now = microtime(true);
+
+        if !fetch checked, this->lagChecks[key] {
+            let checked = 0;
+        }
+
+        if now - checked < this->lagInterval {
+            return true;
+        }
+
+        let this->lagChecks[key] = now;
+
+        try {
+            let lag = call_user_func(this->lagProbe, connection);
+        } catch Throwable, ex {
+            let lag = null;
+        }
+
+        if lag === null || lag > this->lagThreshold {
+            /**
+             * Lagging is not a failure, skip it until the next probe
+             */
+            let this->retryAt[key] = now + this->lagInterval;
+
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Returns true for the errors of a lost or refused connection (SQLSTATE
+     * class 08, MySQL "server has gone away" and "lost connection")
+     *
+     * @param Throwable $exception
+     *
+     * @return bool
+     */
+    protected function isConnectionError(<Throwable> exception) -> bool
+    {
+        var code, info;
+
+        if !(exception instanceof \PDOException) {
+            return false;
+        }
+
+        let code = (string) exception->getCode();
+
+        if starts_with(code, "08") {
+            return true;
+        }
+
+        let info = exception->errorInfo;
+
+        return typeof info === "array" &&
+            isset info[1] &&
+            in_array(info[1], [2002, 2006, 2013]);
+    }
+
+    /**
+     * Returns true if the statement is not a read
+     *
+     * @param string $statement
+     *
+     * @return bool
+     */
+    protected function isWrite(string statement) -> bool
+    {
+        var matches;
+
+        let matches = [];
+
+        if !preg_match("/^[\\s(]*([a-z]+)/i", statement, matches) {
+            return false;
+        }
+
+        return !in_array(
+            strtolower(matches[1]),
+            ["describe", "desc", "explain", "pragma", "select", "set", "show", "with"]
+        );
+    }
+
+    /**
+     * Registers the locator as the listener of the connection
+     *
+     * @param ConnectionInterface $connection
+     */
+    protected function listen(<ConnectionInterface> connection) -> void
+    {
+        if connection instanceof AbstractConnection {
+            connection->setListener([this, "notify"]);
+        }
+    }
+
+    /**
+     * Picks a name according to the weights
+     *
+     * @param array $candidates
+     *
+     * @return string
+     */
+    protected function pick(array candidates) -> string
+    {
+        var name, weight;
+        int number;
+
+        let number = mt_rand(1, array_sum(candidates));
+
+        for name, weight in candidates {
+            let number -= weight;
+
+            if number <= 0 {
+                break;
+            }
+        }
+
+        return (string) name;
+    }
+
+    /**
+     * Returns the instance of a connection, resolving it the first time. The
+     * keys in the `instances` array are formatted as "type-name"
+     *
+     * @param string $type
+     * @param string $name
+     *
+     * @return ConnectionInterface
+     */
+    protected function resolve(string type, string name) -> <ConnectionInterface>
+    {
+        var collection, instanceName, instances;
+
+        let collection   = this->{type},
+            instances    = this->instances,
+            instanceName = type . "-" . name;
 
         if !isset instances[instanceName] {
-            let instances[instanceName] = call_user_func(collection[requested]),
+            let instances[instanceName] = call_user_func(collection[name]),
                 this->instances         = instances;
+
+            this->listen(instances[instanceName]);
         }
 
         return instances[instanceName];
@@ -22,6 +22,10 @@ use Phalcon\Support\Helper\Json\Encode;
 
 /**
  * Sends query profiles to a logger.
+ *
+ * Besides the total `duration`, the time spent preparing, executing and
+ * fetching a statement is available in the `{prepare}`, `{execute}` and
+ * `{fetch}` placeholders of the log format, in nanoseconds.
  */
 class Profiler implements ProfilerInterface
 {
@@ -139,6 +143,28 @@ class Profiler implements ProfilerInterface
         return this->active;
     }
 
+    /**
+     * Records the time elapsed since the start of the entry or the previous
+     * mark as spent in `phase` i.e. "prepare", "execute" or "fetch".
+     *
+     * @param string $phase
+     */
+    public function mark(string phase) -> void
+    {
+        var elapsed, now;
+
+        if unlikely (this->active && isset this->context["mark"]) {
+            let now = hrtime(true);
+
+            if !fetch elapsed, this->context[phase] {
+                let elapsed = 0;
+            }
+
+            let this->context[phase] = elapsed + now - this->context["mark"],
+                this->context["mark"] = now;
+        }
+    }
+
     /**
      * Enable or disable profiler logging.
      *
@@ -188,11 +214,18 @@ class Profiler implements ProfilerInterface
      */
     public function start(string method) -> void
     {
+        var start;
+
         if unlikely this->active {
-            let this->context = [
-                "method" : method,
-                "start"  : hrtime(true)
-            ];
+            let start         = hrtime(true),
+                this->context = [
+                    "execute" : 0,
+                    "fetch"   : 0,
+                    "mark"    : start,
+                    "method"  : method,
+                    "prepare" : 0,
+                    "start"   : start
+                ];
         }
     }
 }
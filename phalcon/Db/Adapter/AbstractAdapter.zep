@@ -859,87 +859,18 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
      */
     public function insert(string table, array! values, var fields = null, var dataTypes = null) -> bool
     {
-        var bindDataTypes, bindType, escapedTable, escapedFields, field,
-            insertSql, insertValues, joinedValues, placeholders, position,
-            tableName, value;
-
-        /**
-         * A valid array with more than one element is required
-         */
-        if unlikely !count(values) {
-            throw new Exception(
-                "Unable to insert into " . table . " without data"
-            );
-        }
+        var statement;
 
-        let placeholders  = [],
-            insertValues  = [],
-            bindDataTypes = [];
-
-        /**
-         * Objects are casted using __toString, null values are converted to
-         * string "null", everything else is passed as "?"
-         */
-        for position, value in values {
-            if typeof value == "object" && value instanceof RawValue {
-                let placeholders[] = (string) value;
-            } else {
-                if typeof value == "object" {
-                    let value = (string) value;
-                }
-
-                if value === null {
-                    let placeholders[] = "null";
-                } else {
-                    let placeholders[] = "?";
-                    let insertValues[] = value;
-
-                    if typeof dataTypes == "array" {
-                        if unlikely !fetch bindType, dataTypes[position] {
-                            throw new Exception(
-                                "Incomplete number of bind types"
-                            );
-                        }
-
-                        let bindDataTypes[] = bindType;
-                    }
-                }
-            }
-        }
-
-        if strpos(table, ".") > 0 {
-            let tableName = explode(".", table);
-        } else {
-            let tableName = table;
-        }
-
-        let escapedTable = this->escapeIdentifier(tableName);
-
-        /**
-         * Build the final SQL INSERT statement
-         */
-        let joinedValues = join(", ", placeholders);
-
-        if typeof fields == "array" {
-            let escapedFields = [];
-
-            for field in fields {
-                let escapedFields[] = this->escapeIdentifier(field);
-            }
-
-            let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES (" . joinedValues . ")";
-        } else {
-            let insertSql = "INSERT INTO " . escapedTable . " VALUES (" . joinedValues . ")";
-        }
+        let statement = this->prepareInsert(table, values, fields, dataTypes);
 
         /**
          * Perform the execution via PDO::execute
          */
-        if !count(bindDataTypes) {
-            return this->{"execute"}(insertSql, insertValues);
+        if !count(statement[2]) {
+            return this->{"execute"}(statement[0], statement[1]);
         }
 
-        return this->{"execute"}(insertSql, insertValues, bindDataTypes);
+        return this->{"execute"}(statement[0], statement[1], statement[2]);
     }
 
     /**
@@ -1408,6 +1339,53 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->update(table, fields, values, whereCondition, dataTypes);
     }
 
+    /**
+     * Inserts a row or updates the existing one in a single statement. The
+     * `conflictFields` (usually the primary key) identify the row, every
+     * other field is updated when the row already exists
+     *
+     * ```php
+     * $success = $connection->upsert(
+     *     "robots",
+     *     [1, "Astro Boy", 1952],
+     *     ["id", "name", "year"],
+     *     ["id"]
+     * );
+     *
+     * // Next SQL sentence is sent to a MySQL database system
+     * INSERT INTO `robots` (`id`, `name`, `year`) VALUES (1, "Astro boy", 1952)
+     *     ON DUPLICATE KEY UPDATE `name` = VALUES(`name`), `year` = VALUES(`year`);
+     * ```
+     */
+    public function upsert(string table, array! values, array! fields, array! conflictFields, var dataTypes = null) -> bool
+    {
+        var field, statement, upsertSql;
+        array updateFields;
+
+        if unlikely !method_exists(this->dialect, "upsert") {
+            throw new Exception(
+                "The dialect '" . get_class(this->dialect) . "' does not support upserts"
+            );
+        }
+
+        let updateFields = [];
+
+        for field in fields {
+            if !in_array(field, conflictFields) {
+                let updateFields[] = field;
+            }
+        }
+
+        let statement = this->prepareInsert(table, values, fields, dataTypes),
+            upsertSql = this->dialect->{"upsert"}(statement[0], conflictFields, updateFields);
+
+        if !count(statement[2]) {
+            return this->{"execute"}(upsertSql, statement[1]);
+        }
+
+        return this->{"execute"}(upsertSql, statement[1], statement[2]);
+    }
+
     /**
      * Check whether the database system requires an explicit value for identity
      * columns
@@ -1440,4 +1418,86 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
     {
         return this->fetchOne(this->dialect->viewExists(viewName, schemaName), Enum::FETCH_NUM)[0] > 0;
     }
+
+    /**
+     * Builds the INSERT statement used by insert() and upsert(). Returns
+     * `[sql, bindParams, bindTypes]`
+     */
+    protected function prepareInsert(string table, array! values, var fields = null, var dataTypes = null) -> array
+    {
+        var bindDataTypes, bindType, escapedTable, escapedFields, field,
+            insertSql, insertValues, joinedValues, placeholders, position,
+            tableName, value;
+
+        /**
+         * A valid array with more than one element is required
+         */
+        if unlikely !count(values) {
+            throw new Exception(
+                "Unable to insert into " . table . " without data"
+            );
+        }
+
+        let placeholders  = [],
+            insertValues  = [],
+            bindDataTypes = [];
+
+        /**
+         * Objects are casted using __toString, null values are converted to
+         * string "null", everything else is passed as "?"
+         */
+        for position, value in values {
+            if typeof value == "object" && value instanceof RawValue {
+                let placeholders[] = (string) value;
+            } else {
+                if typeof value == "object" {
+                    let value = (string) value;
+                }
+
+                if value === null {
+                    let placeholders[] = "null";
+                } else {
+                    let placeholders[] = "?";
+                    let insertValues[] = value;
+
+                    if typeof dataTypes == "array" {
+                        if unlikely !fetch bindType, dataTypes[position] {
+                            throw new Exception(
+                                "Incomplete number of bind types"
+                            );
+                        }
+
+                        let bindDataTypes[] = bindType;
+                    }
+                }
+            }
+        }
+
+        if strpos(table, ".") > 0 {
+            let tableName = explode(".", table);
+        } else {
+            let tableName = table;
+        }
+
+        let escapedTable = this->escapeIdentifier(tableName);
+
+        /**
+         * Build the final SQL INSERT statement
+         */
+        let joinedValues = join(", ", placeholders);
+
+        if typeof fields == "array" {
+            let escapedFields = [];
+
+            for field in fields {
+                let escapedFields[] = this->escapeIdentifier(field);
+            }
+
+            let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES (" . joinedValues . ")";
+        } else {
+            let insertSql = "INSERT INTO " . escapedTable . " VALUES (" . joinedValues . ")";
+        }
+
+        return [insertSql, insertValues, bindDataTypes];
+    }
 }
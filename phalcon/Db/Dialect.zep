@@ -34,6 +34,75 @@ abstract class Dialect implements DialectInterface
         return "SAVEPOINT " . name;
     }
 
+    /**
+     * Builds a DELETE statement
+     *
+     *```php
+     * $sql = $dialect->delete(
+     *     [
+     *         "tables" => [["robots", null]],
+     *         "where"  => [
+     *             "type"  => "binary-op",
+     *             "op"    => "<",
+     *             "left"  => ["type" => "qualified", "name" => "year"],
+     *             "right" => ["type" => "literal", "value" => "2000"],
+     *         ],
+     *     ]
+     * );
+     *
+     * echo $sql; // DELETE FROM `robots` WHERE `year` < 2000
+     *```
+     */
+    public function delete(array! definition) -> string
+    {
+        var alias, bindCounts, escapeChar, schema, sql, table, tables,
+            where;
+
+        if unlikely !fetch tables, definition["tables"] {
+            throw new Exception(
+                "The index 'tables' is required in the definition array"
+            );
+        }
+
+        fetch bindCounts, definition["bindCounts"];
+        if typeof bindCounts !== "array" {
+            let bindCounts = [];
+        }
+
+        let table = tables[0];
+
+        fetch where, definition["where"];
+
+        /**
+         * MySQL before 8.0.16 rejects an alias in a single table DELETE, so
+         * the columns are qualified with the table name instead
+         */
+        if typeof table === "array" && fetch alias, table[2] && alias {
+            if !fetch schema, table[1] {
+                let schema = null;
+            }
+
+            if where {
+                let where = this->replaceQualifiedDomain(
+                    where,
+                    alias,
+                    schema ? schema . "." . table[0] : table[0]
+                );
+            }
+
+            let table = [table[0], schema];
+        }
+
+        let escapeChar = this->escapeChar,
+            sql        = "DELETE FROM " . this->getSqlTable(table, escapeChar);
+
+        if where {
+            let sql .= " " . this->getSqlExpressionWhere(where, escapeChar, bindCounts);
+        }
+
+        return sql;
+    }
+
     /**
      * Escape identifiers
      */
@@ -569,6 +638,116 @@ abstract class Dialect implements DialectInterface
         return sql;
     }
 
+    /**
+     * Builds an UPDATE statement. `fields` are the column names and `values`
+     * the expressions assigned to them
+     *
+     *```php
+     * $sql = $dialect->update(
+     *     [
+     *         "tables" => [["robots", null]],
+     *         "fields" => ["status"],
+     *         "values" => [
+     *             ["type" => "literal", "value" => "1"],
+     *         ],
+     *     ]
+     * );
+     *
+     * echo $sql; // UPDATE `robots` SET `status` = 1
+     *```
+     */
+    public function update(array! definition) -> string
+    {
+        var bindCounts, escapeChar, field, fields, position, sql, tables,
+            values, where;
+        array assignments;
+
+        if unlikely !fetch tables, definition["tables"] {
+            throw new Exception(
+                "The index 'tables' is required in the definition array"
+            );
+        }
+
+        if !fetch fields, definition["fields"] {
+            let fields = [];
+        }
+
+        if unlikely (typeof fields !== "array" || !count(fields)) {
+            throw new Exception(
+                "The index 'fields' is required in the definition array"
+            );
+        }
+
+        if unlikely !fetch values, definition["values"] {
+            throw new Exception(
+                "The index 'values' is required in the definition array"
+            );
+        }
+
+        fetch bindCounts, definition["bindCounts"];
+        if typeof bindCounts !== "array" {
+            let bindCounts = [];
+        }
+
+        let escapeChar  = this->escapeChar,
+            assignments = [];
+
+        for position, field in fields {
+            let assignments[] = this->escape(field, escapeChar) . " = " .
+                this->getSqlExpression(values[position], escapeChar, bindCounts);
+        }
+
+        let sql = "UPDATE " . this->getSqlTable(tables[0], escapeChar) .
+            " SET " . join(", ", assignments);
+
+        if fetch where, definition["where"] && where {
+            let sql .= " " . this->getSqlExpressionWhere(where, escapeChar, bindCounts);
+        }
+
+        return sql;
+    }
+
+    /**
+     * Returns a SQL INSERT modified to update the existing row when one of
+     * the `conflictFields` is already taken
+     *
+     *```php
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO robots (id, name) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"]
+     * );
+     *
+     * echo $sql; // INSERT INTO robots (id, name) VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"
+     *```
+     */
+    public function upsert(string! sqlInsert, array! conflictFields, array! updateFields) -> string
+    {
+        var field;
+        array conflicts, updates;
+
+        if unlikely !count(conflictFields) {
+            throw new Exception("At least one conflict field is required");
+        }
+
+        let conflicts = [],
+            updates   = [];
+
+        for field in conflictFields {
+            let conflicts[] = this->escape(field);
+        }
+
+        if !count(updateFields) {
+            return sqlInsert . " ON CONFLICT (" . join(", ", conflicts) . ") DO NOTHING";
+        }
+
+        for field in updateFields {
+            let updates[] = this->escape(field) . " = EXCLUDED." . this->escape(field);
+        }
+
+        return sqlInsert . " ON CONFLICT (" . join(", ", conflicts) . ") DO UPDATE SET " . join(", ", updates);
+    }
+
     /**
      * Checks whether the platform supports savepoints
      */
@@ -1217,4 +1396,27 @@ abstract class Dialect implements DialectInterface
 
         return this->escape(column, escapeChar);
     }
+
+    /**
+     * Replaces the domain `from` of the qualified columns in an expression
+     * by `to`
+     */
+    protected function replaceQualifiedDomain(array! expression, string! from, string! to) -> array
+    {
+        var domain, key, type, value;
+
+        for key, value in expression {
+            if typeof value === "array" {
+                let expression[key] = this->replaceQualifiedDomain(value, from, to);
+            }
+        }
+
+        if fetch type, expression["type"] && type === "qualified" {
+            if fetch domain, expression["domain"] && domain === from {
+                let expression["domain"] = to;
+            }
+        }
+
+        return expression;
+    }
 }
@@ -823,6 +823,43 @@ class Mysql extends Dialect
         return "TRUNCATE TABLE " . table;
     }
 
+    /**
+     * Returns a SQL INSERT modified with an ON DUPLICATE KEY UPDATE clause.
+     * MySQL resolves the conflict on any unique key, `conflictFields` is only
+     * used when there is nothing to update
+     *
+     *```php
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO `robots` (`id`, `name`) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"]
+     * );
+     *
+     * echo $sql; // INSERT INTO `robots` (`id`, `name`) VALUES (?, ?) ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)
+     *```
+     */
+    public function upsert(string! sqlInsert, array! conflictFields, array! updateFields) -> string
+    {
+        var field;
+        array updates;
+
+        if unlikely !count(conflictFields) {
+            throw new Exception("At least one conflict field is required");
+        }
+
+        let updates = [];
+
+        if !count(updateFields) {
+            let updateFields = array_slice(conflictFields, 0, 1);
+        }
+
+        for field in updateFields {
+            let updates[] = this->escape(field) . " = VALUES(" . this->escape(field) . ")";
+        }
+
+        return sqlInsert . " ON DUPLICATE KEY UPDATE " . join(", ", updates);
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
@@ -17,6 +17,7 @@ use Phalcon\Di\Exception\ServiceResolutionException;
 use Phalcon\Config\Adapter\Php;
 use Phalcon\Config\Adapter\Yaml;
 use Phalcon\Config\ConfigInterface;
+use Phalcon\Dispatcher\AbstractDispatcher;
 use Phalcon\Di\ServiceInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Di\InitializationAwareInterface;
@@ -540,6 +541,46 @@ class Di implements DiInterface
         let self::defaultDi = null;
     }
 
+    /**
+     * Prepares the container for the next request of a long running process.
+     * The shared instances implementing `ResettableInterface` are reset, and
+     * the shared instances of `services` and of the handlers (controllers,
+     * tasks) obtained by the dispatchers are removed so that they are created
+     * again when they are requested
+     *
+     *```php
+     * $container->resetRequestScope(["session", "flashSession"]);
+     *```
+     */
+    public function resetRequestScope(array services = []) -> void
+    {
+        var instance, name, service;
+
+        for instance in this->sharedInstances {
+            if instance instanceof AbstractDispatcher {
+                for name in instance->getResolvedHandlers() {
+                    let services[] = name;
+                }
+            }
+        }
+
+        for name in services {
+            unset this->sharedInstances[name];
+
+            if fetch service, this->services[name] {
+                if service instanceof Service {
+                    service->setSharedInstance(null);
+                }
+            }
+        }
+
+        for instance in this->sharedInstances {
+            if instance instanceof ResettableInterface {
+                instance->resetRequest();
+            }
+        }
+    }
+
     /**
      * Registers a service in the services container
      */
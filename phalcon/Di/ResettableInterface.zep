@@ -0,0 +1,21 @@
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Di;
+
+/**
+ * Interface for components that keep the state of a request.
+ * `resetRequest()` is called by `Phalcon\Di\Di::resetRequestScope()` on the
+ * shared instances before a long running process handles the next request;
+ * it must drop the request state and keep the configuration.
+ */
+interface ResettableInterface
+{
+    public function resetRequest() -> void;
+}
@@ -11,8 +11,10 @@
 namespace Phalcon\Dispatcher;
 
 use Exception;
+use Phalcon\Cache\Adapter\AdapterInterface as CacheAdapterInterface;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Dispatcher\Exception as PhalconException;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
@@ -26,7 +28,7 @@ use Phalcon\Support\Collection;
  * This class can't be instantiated directly, you can use it to create your own
  * dispatchers.
  */
-abstract class AbstractDispatcher extends AbstractInjectionAware implements DispatcherInterface, EventsAwareInterface
+abstract class AbstractDispatcher extends AbstractInjectionAware implements DispatcherInterface, EventsAwareInterface, ResettableInterface
 {
     /**
      * @var object|null
@@ -148,6 +150,23 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
      */
     protected previousNamespaceName = "";
 
+    /**
+     * Service names of the handlers obtained from the container
+     *
+     * @var array
+     */
+    protected resolvedHandlers = [];
+
+    /**
+     * @var CacheAdapterInterface|null
+     */
+    protected resolutionCache = null;
+
+    /**
+     * @var array
+     */
+    protected resolutions = [];
+
     /**
      * @var string|null
      */
@@ -219,7 +238,8 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         int numberDispatches;
         var value, handler, container, namespaceName, handlerName, actionName,
             eventsManager, handlerClass, status, actionMethod,
-            modelBinder, bindCacheKey, isNewHandler, handlerHash, e;
+            modelBinder, bindCacheKey, isNewHandler, handlerHash, resolution,
+            resolutionKey, e;
 
         let container = <DiInterface> this->container;
 
@@ -313,19 +333,45 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 }
             }
 
-            let handlerClass = this->getHandlerClass();
-
             /**
-             * Handlers are retrieved as shared instances from the Service
-             * Container
+             * A cached resolution already holds a handler class that can be
+             * loaded
              */
-            let hasService = (bool) container->has(handlerClass);
-            if !hasService {
+            let resolution    = null,
+                resolutionKey = "";
+
+            if this->resolutionCache !== null {
+                let resolutionKey = this->namespaceName . "|" . this->handlerName . "|" . this->actionName . "|" . this->handlerSuffix . "|" . this->actionSuffix,
+                    resolution    = this->getResolution(resolutionKey);
+
                 /**
-                 * DI doesn't have a service with that name, try to load it
-                 * using an autoloader
+                 * A handler removed since it was cached is resolved again
                  */
-                let hasService = class_exists(handlerClass);
+                if resolution !== null && !container->has(resolution["class"]) && !class_exists(resolution["class"]) {
+                    this->deleteResolution(resolutionKey);
+
+                    let resolution = null;
+                }
+            }
+
+            if resolution !== null {
+                let handlerClass = resolution["class"],
+                    hasService   = true;
+            } else {
+                let handlerClass = this->getHandlerClass();
+
+                /**
+                 * Handlers are retrieved as shared instances from the Service
+                 * Container
+                 */
+                let hasService = (bool) container->has(handlerClass);
+                if !hasService {
+                    /**
+                     * DI doesn't have a service with that name, try to load it
+                     * using an autoloader
+                     */
+                    let hasService = class_exists(handlerClass);
+                }
             }
 
             // If the service can be loaded we throw an exception
@@ -342,7 +388,8 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 break;
             }
 
-            let handler = container->getShared(handlerClass);
+            let handler = container->getShared(handlerClass),
+                this->resolvedHandlers[handlerClass] = true;
 
             // Handlers must be only objects
             if unlikely typeof handler !== "object" {
@@ -358,6 +405,21 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 break;
             }
 
+            /**
+             * The service may return another handler than the cached one,
+             * and an action removed since it was cached is resolved again,
+             * ending in the action not found path
+             */
+            if resolution !== null {
+                if get_class(handler) !== resolution["handler"] {
+                    let resolution = null;
+                } elseif !method_exists(handler, resolution["method"]) {
+                    this->deleteResolution(resolutionKey);
+
+                    let resolution = null;
+                }
+            }
+
             // Check if the handler is new (hasn't been initialized).
             let handlerHash = spl_object_hash(handler);
 
@@ -392,34 +454,45 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 break;
             }
 
-            // Check if the method exists in the handler
-            let actionMethod = this->getActiveMethod();
+            if resolution !== null {
+                let actionMethod = resolution["method"];
+            } else {
+                // Check if the method exists in the handler
+                let actionMethod = this->getActiveMethod();
 
-            if unlikely !is_callable([handler, actionMethod]) {
-                if hasEventsManager {
-                    if eventsManager->fire("dispatch:beforeNotFoundAction", this) === false {
-                        continue;
+                if unlikely !is_callable([handler, actionMethod]) {
+                    if hasEventsManager {
+                        if eventsManager->fire("dispatch:beforeNotFoundAction", this) === false {
+                            continue;
+                        }
+
+                        if this->finished === false {
+                            continue;
+                        }
                     }
 
-                    if this->finished === false {
+                    /**
+                     * Try to throw an exception when an action isn't defined on the
+                     * object
+                     */
+                    let status = this->{"throwDispatchException"}(
+                        "Action '" . actionName . "' was not found on handler '" . handlerName . "'",
+                        PhalconException::EXCEPTION_ACTION_NOT_FOUND
+                    );
+
+                    if status === false && this->finished === false {
                         continue;
                     }
-                }
 
-                /**
-                 * Try to throw an exception when an action isn't defined on the
-                 * object
-                 */
-                let status = this->{"throwDispatchException"}(
-                    "Action '" . actionName . "' was not found on handler '" . handlerName . "'",
-                    PhalconException::EXCEPTION_ACTION_NOT_FOUND
-                );
-
-                if status === false && this->finished === false {
-                    continue;
+                    break;
                 }
 
-                break;
+                let resolution = this->setResolution(
+                    resolutionKey,
+                    handlerClass,
+                    handler,
+                    actionMethod
+                );
             }
 
             /**
@@ -452,7 +525,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
                 }
             }
 
-            if method_exists(handler, "beforeExecuteRoute") {
+            if resolution["beforeExecuteRoute"] {
                 try {
                     // Calling "beforeExecuteRoute" as direct method
                     if handler->beforeExecuteRoute(this) === false || this->finished === false {
@@ -489,7 +562,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
              * @see https://github.com/phalcon/cphalcon/pull/13112
              */
             if isNewHandler {
-                if method_exists(handler, "initialize") {
+                if resolution["initialize"] {
                     try {
                         let this->isControllerInitialize = true;
 
@@ -564,7 +637,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             /**
              * Calling afterBinding as callback and event
              */
-            if method_exists(handler, "afterBinding") {
+            if resolution["afterBinding"] {
                 if handler->afterBinding(this) === false {
                     continue;
                 }
@@ -623,7 +696,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             /**
              * Calling "afterExecuteRoute" as direct method
              */
-            if method_exists(handler, "afterExecuteRoute") {
+            if resolution["afterExecuteRoute"] {
                 try {
                     if handler->afterExecuteRoute(this, value) === false || this->finished === false {
                         continue;
@@ -912,6 +985,24 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->params;
     }
 
+    /**
+     * Returns the service names of the handlers obtained from the container
+     * since the last reset, shared instances that
+     * `Phalcon\Di\Di::resetRequestScope()` removes
+     */
+    public function getResolvedHandlers() -> array
+    {
+        return array_keys(this->resolvedHandlers);
+    }
+
+    /**
+     * Returns the cache of the handler resolutions
+     */
+    public function getResolutionCache() -> <CacheAdapterInterface> | null
+    {
+        return this->resolutionCache;
+    }
+
     /**
      * Check if a param exists
      * @todo deprecate this in the future
@@ -938,6 +1029,31 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->finished;
     }
 
+    /**
+     * Removes the state of the last dispatch; the configuration is kept. The
+     * handlers stay shared in the container, `Phalcon\Di\Di::resetRequestScope()`
+     * removes them before calling this method
+     */
+    public function resetRequest() -> void
+    {
+        let this->activeHandler          = null,
+            this->actionName             = "",
+            this->finished               = false,
+            this->forwarded              = false,
+            this->handlerHashes          = [],
+            this->handlerName            = "",
+            this->isControllerInitialize = false,
+            this->lastHandler            = null,
+            this->moduleName             = "",
+            this->namespaceName          = "",
+            this->params                 = [],
+            this->previousActionName     = "",
+            this->previousHandlerName    = "",
+            this->previousNamespaceName  = "",
+            this->resolvedHandlers       = [],
+            this->returnedValue          = null;
+    }
+
     /**
      * Sets the action name to be dispatched
      */
@@ -1032,6 +1148,38 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         let this->params = params;
     }
 
+    /**
+     * Sets the cache of the handler resolutions. For every namespace, handler
+     * and action it keeps the handler class, the action method and the hooks
+     * that the handler implements, so that a forward or a later request does
+     * not look them up again. The entries that are not valid anymore are
+     * removed. A model binder set afterwards without its own cache keeps the
+     * action parameters in the same cache
+     *
+     * ```php
+     * $dispatcher->setResolutionCache("modelsCache");
+     *
+     * $dispatcher->setModelBinder(
+     *     new Binder()
+     * );
+     * ```
+     */
+    public function setResolutionCache(var cache) -> <DispatcherInterface>
+    {
+        var container;
+
+        if typeof cache === "string" {
+            let container = this->container;
+
+            let cache = container->get(cache);
+        }
+
+        let this->resolutionCache = cache,
+            this->resolutions     = [];
+
+        return this;
+    }
+
     /**
      * Sets the latest returned value by an action manually
      */
@@ -1093,6 +1241,10 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
             let cache = container->get(cache);
         }
 
+        if cache == null {
+            let cache = this->resolutionCache;
+        }
+
         if cache != null {
             modelBinder->setCache(cache);
         }
@@ -1135,6 +1287,66 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         return this->forwarded;
     }
 
+    /**
+     * Removes a stale resolution from the resolution cache
+     */
+    protected function deleteResolution(string key) -> void
+    {
+        unset this->resolutions[key];
+
+        this->resolutionCache->delete("_PHDR_" . md5(key));
+    }
+
+    /**
+     * Returns the cached resolution of a handler, null if it was not resolved
+     * yet
+     */
+    protected function getResolution(string key) -> array | null
+    {
+        var resolution;
+
+        if fetch resolution, this->resolutions[key] {
+            return resolution;
+        }
+
+        let resolution = this->resolutionCache->get("_PHDR_" . md5(key));
+
+        if typeof resolution !== "array" {
+            return null;
+        }
+
+        let this->resolutions[key] = resolution;
+
+        return resolution;
+    }
+
+    /**
+     * Returns the resolution of a handler and stores it in the resolution
+     * cache, when one is set
+     */
+    protected function setResolution(string key, string handlerClass, var handler, string actionMethod) -> array
+    {
+        var resolution;
+
+        let resolution = [
+            "afterBinding"       : method_exists(handler, "afterBinding"),
+            "afterExecuteRoute"  : method_exists(handler, "afterExecuteRoute"),
+            "beforeExecuteRoute" : method_exists(handler, "beforeExecuteRoute"),
+            "class"              : handlerClass,
+            "handler"            : get_class(handler),
+            "initialize"         : method_exists(handler, "initialize"),
+            "method"             : actionMethod
+        ];
+
+        if this->resolutionCache !== null {
+            let this->resolutions[key] = resolution;
+
+            this->resolutionCache->set("_PHDR_" . md5(key), resolution);
+        }
+
+        return resolution;
+    }
+
     /**
      * Set empty properties to their defaults (where defaults are available)
      */
@@ -1161,13 +1373,7 @@ abstract class AbstractDispatcher extends AbstractInjectionAware implements Disp
         var camelCaseInput;
 
         if !fetch camelCaseInput, this->camelCaseMap[input] {
-            let camelCaseInput = join(
-                "",
-                array_map(
-                    "ucfirst",
-                    preg_split("/[_-]+/", input)
-                )
-            );
+            let camelCaseInput = phalcon_str_camelize(input, "_-", false);
 
             let this->camelCaseMap[input] = camelCaseInput;
         }
@@ -69,6 +69,13 @@ class Filter implements FilterInterface
      */
     protected mapper = [];
 
+    /**
+     * Compiled pipelines, keyed by sanitizer specification
+     *
+     * @var array
+     */
+    protected pipelines = [];
+
     /**
      * @var array
      */
@@ -102,6 +109,74 @@ class Filter implements FilterInterface
         return call_user_func_array([sanitizer, "__invoke"], args);
     }
 
+    /**
+     * Compiles a single or set of sanitizers into a reusable pipeline. The
+     * sanitizer names, parameters and instances are resolved once.
+     *
+     *```php
+     * $pipeline = $filter->compile(["trim", "string", "int"]);
+     *
+     * foreach ($rows as $row) {
+     *     $id = $pipeline->process($row["id"]);
+     * }
+     *```
+     *
+     * @param array|string $sanitizers
+     *
+     * @return Pipeline
+     * @throws Exception
+     */
+    public function compile(var sanitizers) -> <Pipeline>
+    {
+        var key, pipeline, sanitizer, sanitizerKey, sanitizerName, split;
+        array steps = [];
+
+        let key = this->getPipelineKey(sanitizers);
+
+        if null !== key && fetch pipeline, this->pipelines[key] {
+            return pipeline;
+        }
+
+        if typeof sanitizers === "array" {
+            for sanitizerKey, sanitizer in sanitizers {
+                let split         = this->splitSanitizerParameters(sanitizerKey, sanitizer),
+                    sanitizerName = (string) split[0],
+                    steps[]       = [
+                        sanitizerName,
+                        this->resolveSanitizer(sanitizerName),
+                        split[1]
+                    ];
+            }
+
+            let pipeline = new Pipeline(steps);
+        } else {
+            let sanitizerName = (string) sanitizers,
+                pipeline      = new Pipeline(
+                    [
+                        [
+                            sanitizerName,
+                            this->resolveSanitizer(sanitizerName),
+                            []
+                        ]
+                    ],
+                    true
+                );
+        }
+
+        if null !== key {
+            /**
+             * Keep the memo bounded when the specifications are dynamic
+             */
+            if count(this->pipelines) >= 256 {
+                let this->pipelines = [];
+            }
+
+            let this->pipelines[key] = pipeline;
+        }
+
+        return pipeline;
+    }
+
     /**
      * Get a service. If it is not in the mapper array, create a new object,
      * set it and then return it.
@@ -182,25 +257,7 @@ class Filter implements FilterInterface
          * The above should produce "-had-a-little-lamb"
          */
 
-        /**
-         * Filter is an array
-         */
-        if typeof sanitizers === "array" {
-            return this->processArraySanitizers(sanitizers, value, noRecursive);
-        }
-
-        /**
-         * Apply a single sanitizer to the values. Check if the values are an
-         * array
-         */
-        if typeof value === "array" && !noRecursive {
-            return this->processArrayValues(value, sanitizers);
-        }
-
-        /**
-         * One value one sanitizer
-         */
-        return this->sanitizer(value, sanitizers);
+        return this->compile(sanitizers)->process(value, noRecursive);
     }
 
     /**
@@ -211,7 +268,8 @@ class Filter implements FilterInterface
      */
     public function set(string name, var service) -> void
     {
-        let this->mapper[name] = service;
+        let this->mapper[name] = service,
+            this->pipelines    = [];
 
         unset this->services[name];
     }
@@ -248,180 +306,55 @@ class Filter implements FilterInterface
     }
 
     /**
-     * @param array $sanitizers
-     * @param mixed $value
-     * @param bool  $noRecursive
+     * Returns the memo key of a specification, or `null` if it contains
+     * parameters that cannot be used to build a key (objects, resources)
      *
-     * @return array|false|mixed|null
-     * @throws Exception
+     * @param mixed $sanitizers
+     *
+     * @return string|null
      */
-    private function processArraySanitizers(
-        array sanitizers,
-        var value,
-        bool noRecursive
-    ) {
-        var sanitizer, sanitizerKey, sanitizerName, sanitizerParams, split;
-
-        /**
-         * Null value - return immediately
-         */
-        if null === value {
-            return value;
-        }
-
-        /**
-         * `value` is something. Loop through the sanitizers
-         */
-        for sanitizerKey, sanitizer in sanitizers {
-            /**
-             * If `sanitizer` is an array, that means that the sanitizerKey
-             * is the name of the sanitizer.
-             */
-            let split           = this->splitSanitizerParameters(sanitizerKey, sanitizer),
-                sanitizerName   = split[0],
-                sanitizerParams = split[1];
+    private function getPipelineKey(var sanitizers) -> string | null
+    {
+        var parameter, sanitizer;
 
-            /**
-             * Check if the value is an array of elements. If `noRecursive`
-             * has been defined it is a straight up; otherwise recursion is
-             * required
-             */
-             if typeof value === "array" {
-                let value = this->processValueIsArray(
-                    value,
-                    sanitizerName,
-                    sanitizerParams,
-                    noRecursive
-                );
-             } else {
-                 let value = this->processValueIsNotArray(
-                     value,
-                     sanitizerName,
-                     sanitizerParams
-                 );
-             }
+        if typeof sanitizers === "string" {
+            return "s:" . sanitizers;
         }
 
-        return value;
-    }
-
-    /**
-     * Processes the array values with the relevant sanitizers
-     *
-     * @param array  $values
-     * @param string $sanitizerName
-     * @param array  $sanitizerParams
-     *
-     * @return array
-     * @throws Exception
-     */
-    private function processArrayValues(
-        array values,
-        string sanitizerName,
-        array sanitizerParams = []
-    ) -> array {
-        var itemKey, itemValue;
-        array arrayValues = [];
-
-        for itemKey, itemValue in values {
-            let arrayValues[itemKey] = this->sanitizer(
-                itemValue,
-                sanitizerName,
-                sanitizerParams
-            );
+        if typeof sanitizers !== "array" {
+            return null;
         }
 
-        return arrayValues;
-    }
-
-    /**
-     * Internal sanitize wrapper for recursion
-     *
-     * @param mixed  $value
-     * @param string $sanitizerName
-     * @param array  $sanitizerParams
-     *
-     * @return false|mixed
-     * @throws Exception
-     */
-    private function sanitizer(
-        var value,
-        string sanitizerName,
-        array sanitizerParams = []
-    ) {
-        var params, sanitizerObject;
-
-        if true !== this->has(sanitizerName) {
-            if true !== empty(sanitizerName) {
-                trigger_error(
-                    "Sanitizer '" . sanitizerName . "' is not registered",
-                    E_USER_NOTICE
-                );
+        for sanitizer in sanitizers {
+            if typeof sanitizer === "array" {
+                for parameter in sanitizer {
+                    if !is_scalar(parameter) && null !== parameter {
+                        return null;
+                    }
+                }
+            } elseif typeof sanitizer !== "string" {
+                return null;
             }
-
-            return value;
         }
 
-        let sanitizerObject = this->get(sanitizerName),
-            params          = array_merge([value], sanitizerParams);
-
-        return call_user_func_array(sanitizerObject, params);
+        return serialize(sanitizers);
     }
 
     /**
-     * @param mixed  $value
-     * @param string $sanitizerName
-     * @param array  $sanitizerParams
-     * @param bool   $noRecursive
+     * Returns the sanitizer instance or `null` if it is not registered
      *
-     * @return array|mixed
-     * @throws Exception
-     */
-    private function processValueIsArray(
-        var value,
-        string sanitizerName,
-        array sanitizerParams,
-        bool noRecursive
-    ) {
-        if noRecursive {
-            let value = this->sanitizer(
-                value,
-                sanitizerName,
-                sanitizerParams
-            );
-        } else {
-            let value = this->processArrayValues(
-                value,
-                sanitizerName,
-                sanitizerParams
-            );
-        }
-
-        return value;
-    }
-
-    /**
-     * @param mixed  $value
-     * @param string $sanitizerName
-     * @param array  $sanitizerParams
+     * @param string $name
      *
-     * @return array|false|mixed
+     * @return mixed
      * @throws Exception
      */
-    private function processValueIsNotArray(
-        var value,
-        string sanitizerName,
-        array sanitizerParams
-    ) {
-        if typeof value !== "array" {
-            let value = this->sanitizer(
-                value,
-                sanitizerName,
-                sanitizerParams
-            );
+    private function resolveSanitizer(string name) -> var
+    {
+        if true !== this->has(name) {
+            return null;
         }
 
-        return value;
+        return this->get(name);
     }
 
     /**
@@ -0,0 +1,177 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Filter;
+
+/**
+ * A sanitizer specification compiled by `Phalcon\Filter\Filter::compile()`.
+ *
+ * The sanitizer names, parameters and instances are resolved once, so the
+ * pipeline can be applied to any number of values without parsing the
+ * specification again.
+ *
+ *```php
+ * $pipeline = $filter->compile(["trim", "replace" => [" ", "-"]]);
+ *
+ * echo $pipeline->process("  mary had a little lamb "); // mary-had-a-little-lamb
+ *```
+ */
+class Pipeline
+{
+    /**
+     * A single sanitizer (string specification) is applied even to `null`
+     * values, a list of sanitizers is not
+     *
+     * @var bool
+     */
+    protected isSingle = false;
+
+    /**
+     * Each step is `[name, sanitizer|null, parameters]`
+     *
+     * @var array
+     */
+    protected steps = [];
+
+    /**
+     * Pipeline constructor.
+     *
+     * @param array $steps
+     * @param bool  $isSingle
+     */
+    public function __construct(array steps, bool isSingle = false)
+    {
+        let this->steps    = steps,
+            this->isSingle = isSingle;
+    }
+
+    /**
+     * Proxy to process()
+     *
+     * @param mixed $value
+     * @param bool  $noRecursive
+     *
+     * @return mixed
+     */
+    public function __invoke(var value, bool noRecursive = false) -> var
+    {
+        return this->process(value, noRecursive);
+    }
+
+    /**
+     * Returns the resolved steps
+     *
+     * @return array
+     */
+    public function getSteps() -> array
+    {
+        return this->steps;
+    }
+
+    /**
+     * Sanitizes a value with the compiled sanitizers
+     *
+     * @param mixed $value
+     * @param bool  $noRecursive
+     *
+     * @return mixed
+     */
+    public function process(var value, bool noRecursive = false) -> var
+    {
+        var step;
+
+        /**
+         * One sanitizer, applied to each element if the value is an array
+         */
+        if this->isSingle {
+            let step = this->steps[0];
+
+            if typeof value === "array" && !noRecursive {
+                return this->processArrayValues(value, step);
+            }
+
+            return this->processStep(value, step);
+        }
+
+        /**
+         * Null value - return immediately
+         */
+        if null === value {
+            return value;
+        }
+
+        for step in this->steps {
+            if typeof value === "array" && !noRecursive {
+                let value = this->processArrayValues(value, step);
+            } else {
+                let value = this->processStep(value, step);
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * Applies one step to every element of an array
+     *
+     * @param array $values
+     * @param array $step
+     *
+     * @return array
+     */
+    private function processArrayValues(array values, array step) -> array
+    {
+        var itemKey, itemValue;
+        array arrayValues = [];
+
+        for itemKey, itemValue in values {
+            let arrayValues[itemKey] = this->processStep(itemValue, step);
+        }
+
+        return arrayValues;
+    }
+
+    /**
+     * Applies one step to a value
+     *
+     * @param mixed $value
+     * @param array $step
+     *
+     * @return mixed
+     */
+    private function processStep(var value, array step) -> var
+    {
+        var sanitizerName, sanitizerObject, sanitizerParams;
+
+        let sanitizerName   = step[0],
+            sanitizerObject = step[1],
+            sanitizerParams = step[2];
+
+        if null === sanitizerObject {
+            if true !== empty(sanitizerName) {
+                trigger_error(
+                    "Sanitizer '" . sanitizerName . "' is not registered",
+                    E_USER_NOTICE
+                );
+            }
+
+            return value;
+        }
+
+        if empty sanitizerParams {
+            return call_user_func(sanitizerObject, value);
+        }
+
+        return call_user_func_array(
+            sanitizerObject,
+            array_merge([value], sanitizerParams)
+        );
+    }
+}
@@ -16,6 +16,7 @@ use Phalcon\Di\Injectable;
 use Phalcon\Filter\FilterInterface;
 use Phalcon\Messages\MessageInterface;
 use Phalcon\Messages\Messages;
+use Phalcon\Filter\Validation\BatchValidatorInterface;
 use Phalcon\Filter\Validation\ValidationInterface;
 use Phalcon\Filter\Validation\Exception;
 use Phalcon\Filter\Validation\ValidatorInterface;
@@ -26,6 +27,20 @@ use Phalcon\Filter\Validation\AbstractCombinedFieldsValidator;
  */
 class Validation extends Injectable implements ValidationInterface
 {
+    /**
+     * Failed row keys of the batch validators, while validateBatch() runs
+     *
+     * @var array|null
+     */
+    protected batchFailures = null;
+
+    /**
+     * Key of the row being validated by validateBatch()
+     *
+     * @var mixed
+     */
+    protected batchRow = null;
+
     /**
      * @var array
      */
@@ -321,8 +336,11 @@ class Validation extends Injectable implements ValidationInterface
         let entity = this->entity;
         let data = this->data;
 
-        //  If the entity is an object use it to retrieve the values
-        if typeof entity == "object" {
+        /**
+         * If the entity is an object use it to retrieve the values, except
+         * while validating a batch, where the values are those of the rows
+         */
+        if typeof entity == "object" && this->batchRow === null {
             let value = this->getValueByEntity(entity, field);
             if value === null {
                 let isRawFetched = true;
@@ -364,9 +382,10 @@ class Validation extends Injectable implements ValidationInterface
                 let value = filterService->sanitize(value, fieldFilters);
 
                 /**
-                 * Set filtered value in entity
+                 * Set filtered value in entity, except while validating a
+                 * batch, where the value is that of a row
                  */
-                if typeof entity == "object" && isRawFetched === false {
+                if typeof entity == "object" && isRawFetched === false && this->batchRow === null {
                     let method = "set" . camelize(field);
 
                     if method_exists(entity, method) {
@@ -543,7 +562,7 @@ class Validation extends Injectable implements ValidationInterface
                 /**
                  * Check if the validation must be canceled if this validator fails
                  */
-                if validator->validate(this, field) === false {
+                if this->validateField(field, validator) === false {
                     if validator->getOption("cancelOnFail") {
                         break;
                     }
@@ -574,7 +593,7 @@ class Validation extends Injectable implements ValidationInterface
             /**
              * Check if the validation must be canceled if this validator fails
              */
-            if validator->validate(this, field) === false {
+            if this->validateField(field, validator) === false {
                 if validator->getOption("cancelOnFail") {
                     break;
                 }
@@ -591,6 +610,178 @@ class Validation extends Injectable implements ValidationInterface
         return this->messages;
     }
 
+    /**
+     * Validates a set of rows (grid edits, imports) according to the rules.
+     * Validators implementing `BatchValidatorInterface` check all the rows
+     * at once (Uniqueness issues one query per chunk instead of one per
+     * row), the rest run for each row as in validate(). The values are read
+     * from the rows; the entity is only the model that validators such as
+     * Uniqueness check against.
+     *
+     *```php
+     * $messages = $validation->validateBatch($rows, new Users());
+     *
+     * foreach ($messages as $key => $rowMessages) {
+     *     if (count($rowMessages) > 0) {
+     *         // $rows[$key] is not valid
+     *     }
+     * }
+     *```
+     *
+     * @param array       $rows
+     * @param object|null $entity
+     *
+     * @return array The Messages (or false) of each row, keyed as the rows
+     */
+    public function validateBatch(array rows, var entity = null) -> array
+    {
+        var field, rowKey, row, scope, validator, validators;
+        array failures = [], results = [];
+
+        if entity !== null {
+            this->setEntity(entity);
+        }
+
+        /**
+         * Run the batch validators first, each with the values of all rows
+         */
+        for field, validators in this->validators {
+            for validator in validators {
+                if validator instanceof BatchValidatorInterface {
+                    let failures[this->getBatchKey(field, validator)] = array_flip(
+                        this->validateBatchField(rows, field, validator)
+                    );
+                }
+            }
+        }
+
+        for scope in this->combinedFieldsValidators {
+            let field     = scope[0],
+                validator = scope[1];
+
+            if validator instanceof BatchValidatorInterface {
+                let failures[this->getBatchKey(field, validator)] = array_flip(
+                    this->validateBatchField(rows, field, validator)
+                );
+            }
+        }
+
+        let this->batchFailures = failures;
+
+        for rowKey, row in rows {
+            let this->batchRow  = rowKey,
+                results[rowKey] = this->validate(row);
+        }
+
+        let this->batchFailures = null,
+            this->batchRow      = null;
+
+        return results;
+    }
+
+    /**
+     * Returns the key of a field/validator pair for the batch failures
+     *
+     * @param array|string       $field
+     * @param ValidatorInterface $validator
+     *
+     * @return string
+     */
+    protected function getBatchKey(var field, <ValidatorInterface> validator) -> string
+    {
+        if typeof field === "array" {
+            let field = implode(",", field);
+        }
+
+        return spl_object_hash(validator) . ":" . field;
+    }
+
+    /**
+     * Collects the values of all the rows for a batch validator and returns
+     * the keys of the rows that failed
+     *
+     * @param array                   $rows
+     * @param array|string            $field
+     * @param BatchValidatorInterface $validator
+     *
+     * @return array
+     */
+    protected function validateBatchField(
+        array rows,
+        var field,
+        <BatchValidatorInterface> validator
+    ) -> array {
+        var row, rowKey, singleField, fields, primaryKey;
+        array rowValues, values = [];
+
+        let fields = field;
+        if typeof fields !== "array" {
+            let fields = [field];
+        }
+
+        /**
+         * The field holding the primary key of the record edited by each
+         * row, which validators such as Uniqueness exclude
+         */
+        let primaryKey = validator->getOption("primaryKey");
+        if primaryKey !== null && !in_array(primaryKey, fields) {
+            let fields[] = primaryKey;
+        }
+
+        for rowKey, row in rows {
+            let this->batchRow = rowKey,
+                this->data     = row,
+                this->values   = [];
+
+            if this->preChecking(field, validator) {
+                continue;
+            }
+
+            let rowValues = [];
+            for singleField in fields {
+                let rowValues[singleField] = this->getValue(singleField);
+            }
+
+            let values[rowKey] = rowValues;
+        }
+
+        if empty values {
+            return [];
+        }
+
+        return validator->validateBatch(this, field, values);
+    }
+
+    /**
+     * Runs a validator for a field. While validating a batch, validators
+     * implementing `BatchValidatorInterface` use the precomputed results
+     *
+     * @param array|string       $field
+     * @param ValidatorInterface $validator
+     *
+     * @return bool
+     */
+    protected function validateField(var field, <ValidatorInterface> validator) -> bool
+    {
+        var failed;
+
+        if this->batchFailures !== null && validator instanceof BatchValidatorInterface {
+            if fetch failed, this->batchFailures[this->getBatchKey(field, validator)] {
+                if isset failed[this->batchRow] {
+                    this->appendMessage(
+                        validator->messageFactory(this, field)
+                    );
+
+                    return false;
+                }
+
+                return true;
+            }
+        }
+
+        return validator->validate(this, field);
+    }
+
     /**
      * Internal validations, if it returns true, then skip the current validator
      *
@@ -0,0 +1,49 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Filter\Validation;
+
+use Phalcon\Filter\Validation;
+use Phalcon\Messages\Message;
+
+/**
+ * Interface for validators that can check all the rows passed to
+ * `Phalcon\Filter\Validation::validateBatch()` at once
+ */
+interface BatchValidatorInterface extends ValidatorInterface
+{
+    /**
+     * Create a default message by factory
+     *
+     * @param Validation   $validation
+     * @param array|string $field
+     * @param array        $replacements
+     *
+     * @return Message
+     */
+    public function messageFactory(
+        <Validation> validation,
+        var field,
+        array replacements = []
+    ) -> <Message>;
+
+    /**
+     * Validates the values of all the rows. `values` is keyed by row and
+     * holds the field => value pairs of each row. Returns the keys of the
+     * rows that failed
+     *
+     * @param Validation   $validation
+     * @param array|string $field
+     * @param array        $values
+     *
+     * @return array
+     */
+    public function validateBatch(<Validation> validation, var field, array values) -> array;
+}
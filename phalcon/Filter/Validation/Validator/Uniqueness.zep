@@ -15,6 +15,7 @@ use Phalcon\Mvc\Model;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Filter\Validation;
 use Phalcon\Filter\Validation\AbstractCombinedFieldsValidator;
+use Phalcon\Filter\Validation\BatchValidatorInterface;
 use Phalcon\Filter\Validation\Exception;
 //use Phalcon\Mvc\CollectionInterface;
 //use Phalcon\Mvc\Collection;
@@ -88,8 +89,57 @@ use Phalcon\Filter\Validation\Exception;
  *     )
  * );
  * ```
+ *
+ * When used with `Phalcon\Filter\Validation::validateBatch()`, the rows are
+ * checked with one query per chunk of `batchSize` rows (default 500). The
+ * rows matching a returned value exactly fail at once. The database may also
+ * return values that it compares as equal to other rows (case insensitive
+ * collations, trailing blanks, decimals such as "1.50" and "1.5"), so the
+ * rows matching a returned value once both are case folded, without
+ * trailing blanks and with numbers in a canonical form, are counted one by
+ * one as validate() does. Values equal only with other rules of the
+ * collation, such as accents, are not detected:
+ *
+ * ```php
+ * $validator->add(
+ *     "username",
+ *     new UniquenessValidator(
+ *         [
+ *             "model"     => new Users(),
+ *             "batchSize" => 200,
+ *         ]
+ *     )
+ * );
+ *
+ * $messages = $validator->validateBatch($rows);
+ * ```
+ *
+ * The rows of a batch are checked against all the records except, when it
+ * is persistent, the validated entity. Rows editing existing records name
+ * the field holding their primary key with `primaryKey`, so that each row
+ * excludes its own record instead. It requires a model with a single
+ * primary key column:
+ *
+ * ```php
+ * $validator->add(
+ *     "username",
+ *     new UniquenessValidator(
+ *         [
+ *             "model"      => new Users(),
+ *             "primaryKey" => "id",
+ *         ]
+ *     )
+ * );
+ *
+ * $messages = $validator->validateBatch(
+ *     [
+ *         ["id" => 1, "username" => "jane"],
+ *         ["id" => 2, "username" => "john"],
+ *     ]
+ * );
+ * ```
  */
-class Uniqueness extends AbstractCombinedFieldsValidator
+class Uniqueness extends AbstractCombinedFieldsValidator implements BatchValidatorInterface
 {
     protected template = "Field :field must be unique";
 
@@ -107,7 +157,9 @@ class Uniqueness extends AbstractCombinedFieldsValidator
      *     'allowEmpty' => false,
      *     'convert'    => null,
      *     'model'      => null,
-     *     'except'     => null
+     *     'except'     => null,
+     *     'batchSize'  => 500,
+     *     'primaryKey' => null
      * ]
      */
     public function __construct(array! options = [])
@@ -131,6 +183,308 @@ class Uniqueness extends AbstractCombinedFieldsValidator
         return true;
     }
 
+    /**
+     * Executes the validation for all the rows of a batch. Rows with empty
+     * values or validated with the `except` option are checked one by one
+     */
+    public function validateBatch(<Validation> validation, var field, array values) -> array
+    {
+        var attributes, batchSize, chunk, className, convert, existing, fields,
+            id, key, params, primaryColumn, primaryKey, record, row, rowKey,
+            rowValues, rows, singleField, value;
+        bool isSingle;
+        array candidates, conflicts, failed = [], ids = [], pending = [];
+
+        let fields = field;
+        if typeof fields !== "array" {
+            let fields = [field];
+        }
+
+        let convert       = this->getOption("convert"),
+            primaryKey    = this->getOption("primaryKey"),
+            record        = this->getRecord(validation),
+            className     = get_class(record),
+            primaryColumn = this->getBatchPrimaryColumn(record);
+
+        for rowKey, rowValues in values {
+            if primaryKey !== null {
+                if !fetch id, rowValues[primaryKey] {
+                    let id = null;
+                }
+
+                let ids[rowKey] = id;
+            }
+
+            if convert != null {
+                let rowValues = {convert}(rowValues);
+
+                if unlikely !is_array(rowValues) {
+                    throw new Exception("Value conversion must return an array");
+                }
+            }
+
+            let isSingle = this->hasOption("except");
+
+            if !isSingle {
+                for singleField in fields {
+                    let value = rowValues[singleField];
+
+                    if value == null {
+                        let isSingle = true;
+
+                        break;
+                    }
+                }
+            }
+
+            if isSingle {
+                let params = this->getBatchRowParams(record, fields, rowValues, primaryColumn, ids, rowKey);
+
+                if {className}::count(params) != 0 {
+                    let failed[] = rowKey;
+                }
+
+                continue;
+            }
+
+            let pending[rowKey] = rowValues;
+        }
+
+        if empty pending {
+            return failed;
+        }
+
+        let attributes = [];
+        for singleField in fields {
+            let attributes[singleField] = this->getColumnNameReal(
+                record,
+                this->getOption("attribute", singleField)
+            );
+        }
+
+        let batchSize = (int) this->getOption("batchSize", 500);
+        if batchSize < 1 {
+            let batchSize = 500;
+        }
+
+        for chunk in array_chunk(pending, batchSize, true) {
+            let params     = this->getBatchParams(record, attributes, chunk, primaryColumn),
+                existing   = {className}::find(params),
+                rows       = existing->toArray(),
+                conflicts  = [],
+                candidates = [];
+
+            if empty rows {
+                continue;
+            }
+
+            /**
+             * The primary keys of the records holding each value, null
+             * without the primaryKey option
+             */
+            for row in rows {
+                let key = this->getBatchValuesKey(attributes, row, true);
+
+                if primaryColumn === null {
+                    let conflicts[key][] = null;
+                } else {
+                    let conflicts[key][] = row[primaryColumn];
+                }
+
+                let candidates[this->getBatchValuesKey(attributes, row, true, true)] = true;
+            }
+
+            for rowKey, rowValues in chunk {
+                if !fetch id, ids[rowKey] {
+                    let id = null;
+                }
+
+                let key = this->getBatchValuesKey(attributes, rowValues, false);
+
+                if isset conflicts[key] {
+                    if this->isBatchConflict(conflicts[key], id) {
+                        let failed[] = rowKey;
+                    }
+
+                    continue;
+                }
+
+                /**
+                 * The returned values may be equal to this row only with the
+                 * comparison of the database
+                 */
+                if !isset candidates[this->getBatchValuesKey(attributes, rowValues, false, true)] {
+                    continue;
+                }
+
+                let params = this->getBatchRowParams(record, fields, rowValues, primaryColumn, ids, rowKey);
+
+                if {className}::count(params) != 0 {
+                    let failed[] = rowKey;
+                }
+            }
+        }
+
+        return failed;
+    }
+
+    /**
+     * Builds the query parameters returning the existing values of a chunk,
+     * with the primary key of their records when `primaryColumn` is set
+     */
+    protected function getBatchParams(var record, array attributes, array chunk, var primaryColumn = null) -> array
+    {
+        var attribute, columns, metaData, primaryField, rowValues, singleField;
+        array conditions, matches = [], params, rowConditions;
+        bool isSingle;
+        int index = 0;
+
+        let columns = array_values(attributes);
+        if primaryColumn !== null && !in_array(primaryColumn, columns) {
+            let columns[] = primaryColumn;
+        }
+
+        let params = [
+            "columns": implode(", ", columns),
+            "bind":    []
+        ];
+
+        let isSingle = count(attributes) == 1;
+
+        for rowValues in chunk {
+            let rowConditions = [];
+            for singleField, attribute in attributes {
+                if isSingle {
+                    let rowConditions[] = "?" . index;
+                } else {
+                    let rowConditions[] = attribute . " = ?" . index;
+                }
+
+                let params["bind"][] = rowValues[singleField];
+                let index++;
+            }
+
+            let matches[] = isSingle ? rowConditions[0] : "(" . join(" AND ", rowConditions) . ")";
+        }
+
+        if isSingle {
+            let conditions = [
+                current(attributes) . " IN (" . join(", ", matches) . ")"
+            ];
+        } else {
+            let conditions = [
+                "(" . join(" OR ", matches) . ")"
+            ];
+        }
+
+        /**
+         * If the operation is update, there must be values in the object.
+         * Rows with their own primary key exclude their records instead
+         */
+        if primaryColumn === null && record->getDirtyState() == Model::DIRTY_STATE_PERSISTENT {
+            let metaData = record->getDI()->getShared("modelsMetadata");
+
+            for primaryField in metaData->getPrimaryKeyAttributes(record) {
+                let conditions[] = this->getColumnNameReal(record, primaryField) . " <> ?" . index;
+
+                let params["bind"][] = record->readAttribute(
+                    this->getColumnNameReal(record, primaryField)
+                );
+
+                let index++;
+            }
+        }
+
+        let params["conditions"] = join(" AND ", conditions);
+
+        return params;
+    }
+
+    /**
+     * Returns the primary key column excluded by each row with the
+     * `primaryKey` option, null without it
+     */
+    protected function getBatchPrimaryColumn(var record) -> string | null
+    {
+        var primaryKeys;
+
+        if this->getOption("primaryKey") === null {
+            return null;
+        }
+
+        let primaryKeys = record->getDI()
+            ->getShared("modelsMetadata")
+            ->getPrimaryKeyAttributes(record);
+
+        if unlikely count(primaryKeys) !== 1 {
+            throw new Exception(
+                "The primaryKey option requires a model with a single primary key"
+            );
+        }
+
+        return this->getColumnNameReal(record, primaryKeys[0]);
+    }
+
+    /**
+     * Builds the query parameters counting the records with the values of a
+     * row, except the record of the row with the `primaryKey` option
+     */
+    protected function getBatchRowParams(
+        var record,
+        array fields,
+        array rowValues,
+        var primaryColumn,
+        array ids,
+        var rowKey
+    ) -> array {
+        var id;
+        array params;
+
+        if primaryColumn === null {
+            return this->isUniquenessModel(record, fields, rowValues);
+        }
+
+        let params = this->isUniquenessModel(record, fields, rowValues, false);
+
+        if fetch id, ids[rowKey] && id !== null {
+            let params["conditions"] = params["conditions"] . " AND " . primaryColumn . " <> ?" . count(params["bind"]),
+                params["bind"][]     = id;
+        }
+
+        return params;
+    }
+
+    /**
+     * Returns the lookup key of a set of values, either a row coming from
+     * the database (keyed by attribute) or a validated row (keyed by field).
+     * Normalized keys compare the values as databases usually do
+     */
+    protected function getBatchValuesKey(
+        array attributes,
+        array values,
+        bool byAttribute,
+        bool normalize = false
+    ) -> string {
+        var attribute, singleField, value;
+        array parts = [];
+
+        for singleField, attribute in attributes {
+            if byAttribute {
+                let value = values[attribute];
+            } else {
+                let value = values[singleField];
+            }
+
+            if normalize {
+                let parts[] = this->normalizeBatchValue(value);
+            } else {
+                let parts[] = (string) value;
+            }
+        }
+
+        return json_encode(parts);
+    }
+
     /**
      * The column map is used in the case to get real column name
      */
@@ -150,6 +504,46 @@ class Uniqueness extends AbstractCombinedFieldsValidator
         return field;
     }
 
+    /**
+     * Returns the model the uniqueness is checked against
+     */
+    protected function getRecord(<Validation> validation) -> var
+    {
+        var record;
+
+        let record = this->getOption("model");
+
+        if empty record || typeof record != "object" {
+            // check validation getEntity() method
+            let record = validation->getEntity();
+
+            if unlikely empty record {
+                throw new Exception(
+                    "Model of record must be set to property \"model\""
+                );
+            }
+        }
+
+        return record;
+    }
+
+    /**
+     * Returns whether the records holding the values of a row, given by
+     * their primary keys, include another record than the row's own one
+     */
+    protected function isBatchConflict(array ids, var id) -> bool
+    {
+        var existing;
+
+        for existing in ids {
+            if id === null || existing === null || (string) existing !== (string) id {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     protected function isUniqueness(<Validation> validation, var field) -> bool
     {
         var values, convert, record, params, className, isModel, singleField;
@@ -180,18 +574,7 @@ class Uniqueness extends AbstractCombinedFieldsValidator
             }
         }
 
-        let record = this->getOption("model");
-
-        if empty record || typeof record != "object" {
-            // check validation getEntity() method
-            let record = validation->getEntity();
-
-            if unlikely empty record {
-                throw new Exception(
-                    "Model of record must be set to property \"model\""
-                );
-            }
-        }
+        let record = this->getRecord(validation);
 
         let isModel = record instanceof ModelInterface;
 //
@@ -300,9 +683,10 @@ class Uniqueness extends AbstractCombinedFieldsValidator
 //    }
 
     /**
-     * Uniqueness method used for model
+     * Uniqueness method used for model. The primary key of a persistent
+     * record is excluded unless `excludeRecord` is false
      */
-    protected function isUniquenessModel(var record, array field, array values)
+    protected function isUniquenessModel(var record, array field, array values, bool excludeRecord = true)
     {
         var index, params, attribute, metaData, primaryField, singleField,
             fieldExcept, singleExcept, notInValues, exceptConditions, value,
@@ -402,7 +786,7 @@ class Uniqueness extends AbstractCombinedFieldsValidator
         /**
          * If the operation is update, there must be values in the object
          */
-        if record->getDirtyState() == Model::DIRTY_STATE_PERSISTENT {
+        if excludeRecord && record->getDirtyState() == Model::DIRTY_STATE_PERSISTENT {
             let metaData = record->getDI()->getShared("modelsMetadata");
 
             for primaryField in metaData->getPrimaryKeyAttributes(record) {
@@ -427,4 +811,17 @@ class Uniqueness extends AbstractCombinedFieldsValidator
 
         return params;
     }
+
+    /**
+     * Returns a value case folded, without trailing blanks, or a number in a
+     * canonical form ("1.50" and "1.5" are the same)
+     */
+    protected function normalizeBatchValue(var value) -> string
+    {
+        if is_numeric(value) {
+            return (string) floatval(value);
+        }
+
+        return mb_strtolower(rtrim((string) value, " "));
+    }
 }
@@ -13,6 +13,7 @@ namespace Phalcon\Flash;
 use Phalcon\Di\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Html\Escaper\EscaperInterface;
 use Phalcon\Session\ManagerInterface as SessionInterface;
 use Phalcon\Support\Helper\Str\Interpolate;
@@ -30,7 +31,7 @@ use Phalcon\Support\Helper\Str\Interpolate;
  *
  * @package Phalcon\Flash
  */
-abstract class AbstractFlash extends AbstractInjectionAware implements FlashInterface
+abstract class AbstractFlash extends AbstractInjectionAware implements FlashInterface, ResettableInterface
 {
     /**
      * @var bool
@@ -210,6 +211,15 @@ abstract class AbstractFlash extends AbstractInjectionAware implements FlashInte
         return this->{"message"}("notice", message);
     }
 
+    /**
+     * Removes the messages of the last request. The messages stored in the
+     * session are kept for the next one
+     */
+    public function resetRequest() -> void
+    {
+        let this->messages = [];
+    }
+
     /**
      * Set the autoescape mode in generated HTML
      *
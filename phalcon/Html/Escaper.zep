@@ -106,6 +106,16 @@ class Escaper implements EscaperInterface
      */
     public function css(string input) -> string
     {
+        var escaped;
+
+        /**
+         * Valid UTF-8 is escaped directly, without converting it first
+         */
+        let escaped = phalcon_escape_css_utf8(input);
+        if likely typeof escaped === "string" {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -253,12 +263,8 @@ class Escaper implements EscaperInterface
         if null === input {
             return "";
         }
-        return htmlspecialchars(
-            input,
-            this->flags,
-            this->encoding,
-            this->doubleEncode
-        );
+
+        return this->phpHtmlSpecialChars(input);
     }
 
     /**
@@ -271,6 +277,16 @@ class Escaper implements EscaperInterface
      */
     public function js(string input) -> string
     {
+        var escaped;
+
+        /**
+         * Valid UTF-8 is escaped directly, without converting it first
+         */
+        let escaped = phalcon_escape_js_utf8(input);
+        if likely typeof escaped === "string" {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -382,6 +398,23 @@ class Escaper implements EscaperInterface
      */
     protected function phpHtmlSpecialChars(string input) -> string
     {
+        var escaped;
+
+        /**
+         * UTF-8 with double encoding is handled natively. Anything the native
+         * escaper cannot reproduce exactly (invalid sequences, ENT_DISALLOWED)
+         * goes through htmlspecialchars
+         */
+        if likely (
+            this->doubleEncode &&
+            ("utf-8" === this->encoding || "UTF-8" === this->encoding)
+        ) {
+            let escaped = phalcon_escape_html(input, this->flags);
+            if likely typeof escaped === "string" {
+                return escaped;
+            }
+        }
+
         return htmlspecialchars(
             input,
             this->flags,
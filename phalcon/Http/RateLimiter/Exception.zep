@@ -0,0 +1,20 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Http\RateLimiter;
+
+/**
+ * Phalcon\Http\RateLimiter\Exception
+ *
+ * Exceptions thrown in Phalcon\Http\RateLimiter will use this class.
+ */
+class Exception extends \Exception
+{
+}
@@ -0,0 +1,177 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Http\RateLimiter;
+
+use Phalcon\Di\DiInterface;
+use Phalcon\Dispatcher\DispatcherInterface;
+use Phalcon\Events\EventInterface;
+use Phalcon\Http\ResponseInterface;
+use Phalcon\Mvc\Micro;
+use Phalcon\Mvc\Micro\MiddlewareInterface;
+use Phalcon\Storage\RateLimiter;
+
+/**
+ * Rejects requests over the limit with a `429 Too Many Requests` response
+ * before the handler is instantiated.
+ *
+ * It can be attached as a `before` middleware of `Phalcon\Mvc\Micro` or as a
+ * `dispatch` listener of the dispatcher.
+ *
+ *```php
+ * use Phalcon\Http\RateLimiter\Middleware;
+ * use Phalcon\Storage\RateLimiter;
+ *
+ * $middleware = new Middleware(
+ *     new RateLimiter($redis, 100, 60)
+ * );
+ *
+ * // Micro
+ * $app->before($middleware);
+ *
+ * // Dispatcher
+ * $eventsManager->attach("dispatch", $middleware);
+ *```
+ *
+ * The key defaults to the client address. A callable receiving the request
+ * can be passed to limit by something else, for instance an API token.
+ */
+class Middleware implements MiddlewareInterface
+{
+    /**
+     * @var callable|null
+     */
+    protected keyResolver = null;
+
+    /**
+     * @var RateLimiter
+     */
+    protected limiter;
+
+    /**
+     * Middleware constructor.
+     *
+     * @param RateLimiter   $limiter
+     * @param callable|null $keyResolver
+     */
+    public function __construct(<RateLimiter> limiter, var keyResolver = null)
+    {
+        if unlikely (null !== keyResolver && !is_callable(keyResolver)) {
+            throw new Exception("The key resolver must be a callable");
+        }
+
+        let this->limiter     = limiter,
+            this->keyResolver = keyResolver;
+    }
+
+    /**
+     * Dispatcher listener, returns `false` to stop the dispatch loop when the
+     * limit has been reached
+     *
+     * @param EventInterface      $event
+     * @param DispatcherInterface $dispatcher
+     *
+     * @return bool
+     */
+    public function beforeDispatch(
+        <EventInterface> event,
+        <DispatcherInterface> dispatcher
+    ) -> bool {
+        var response;
+
+        let response = this->check(dispatcher->getDI());
+
+        if null === response {
+            return true;
+        }
+
+        dispatcher->setReturnedValue(response);
+
+        return false;
+    }
+
+    /**
+     * Micro middleware, sends the 429 response and stops the application when
+     * the limit has been reached
+     *
+     * @param Micro $application
+     *
+     * @return bool|ResponseInterface
+     */
+    public function call(<Micro> application)
+    {
+        var response;
+
+        let response = this->check(application->getDI());
+
+        if null === response {
+            return true;
+        }
+
+        /**
+         * A stopped application returns before sending the response
+         */
+        if !response->isSent() {
+            response->send();
+        }
+
+        application->stop();
+
+        return response;
+    }
+
+    /**
+     * @return RateLimiter
+     */
+    public function getLimiter() -> <RateLimiter>
+    {
+        return this->limiter;
+    }
+
+    /**
+     * Consumes a token for the current request. Returns the 429 response if
+     * the limit has been reached, `null` otherwise
+     *
+     * @param DiInterface $container
+     *
+     * @return ResponseInterface|null
+     */
+    protected function check(<DiInterface> container) -> <ResponseInterface> | null
+    {
+        var key, request, response;
+
+        if unlikely typeof container !== "object" {
+            throw new Exception(
+                "A dependency injection container is required to access the 'request' and 'response' services"
+            );
+        }
+
+        let request = container->getShared("request");
+
+        if null !== this->keyResolver {
+            let key = (string) call_user_func(this->keyResolver, request);
+        } else {
+            let key = (string) request->getClientAddress();
+        }
+
+        if this->limiter->consume(key) {
+            return null;
+        }
+
+        let response = container->getShared("response");
+
+        response->setStatusCode(429, "Too Many Requests");
+        response->setHeader("Retry-After", (string) this->limiter->getRetryAfter());
+        response->setHeader("X-RateLimit-Limit", (string) this->limiter->getLimit());
+        response->setHeader("X-RateLimit-Remaining", (string) this->limiter->getRemaining());
+
+        return response;
+    }
+}
@@ -12,6 +12,7 @@ namespace Phalcon\Http;
 
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Filter\FilterInterface;
 use Phalcon\Http\Message\RequestMethodInterface;
@@ -48,7 +49,7 @@ use stdClass;
  * $request->getLanguages();
  *```
  */
-class Request extends AbstractInjectionAware implements RequestInterface, RequestMethodInterface
+class Request extends AbstractInjectionAware implements RequestInterface, RequestMethodInterface, ResettableInterface
 {
     /**
      * @var FilterInterface|null
@@ -1284,6 +1285,17 @@ class Request extends AbstractInjectionAware implements RequestInterface, Reques
         return numberFiles;
     }
 
+    /**
+     * Removes the raw body and the PUT/PATCH data read for the last request;
+     * the filters are kept
+     */
+    public function resetRequest() -> void
+    {
+        let this->patchCache = null,
+            this->putCache   = null,
+            this->rawBody    = "";
+    }
+
     /**
      * Set the HTTP method parameter override flag
      *
@@ -15,6 +15,7 @@ use DateTimeZone;
 use Phalcon\Di\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Http\Message\ResponseStatusCodeInterface;
@@ -40,7 +41,7 @@ use Phalcon\Support\Helper\Json\Encode;
  * $response->send();
  *```
  */
-class Response implements ResponseInterface, InjectionAwareInterface, EventsAwareInterface, ResponseStatusCodeInterface
+class Response implements ResponseInterface, InjectionAwareInterface, EventsAwareInterface, ResponseStatusCodeInterface, ResettableInterface
 {
     /**
      * @var DiInterface|null
@@ -322,6 +323,7 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
 
         return this;
     }
+
     /**
      * Resets all the established headers
      */
@@ -332,6 +334,19 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
         return this;
     }
 
+    /**
+     * Removes the content, the file to send and the headers, and allows the
+     * response to be sent again
+     */
+    public function resetRequest() -> void
+    {
+        let this->content = null,
+            this->file    = null,
+            this->sent    = false;
+
+        this->headers->reset();
+    }
+
     /**
      * Prints out HTTP response to the client
      */
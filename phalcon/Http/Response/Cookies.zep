@@ -12,6 +12,7 @@ namespace Phalcon\Http\Response;
 
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Http\Cookie\Exception;
 use Phalcon\Http\Cookie\CookieInterface;
 
@@ -63,7 +64,7 @@ use Phalcon\Http\Cookie\CookieInterface;
  * );
  * ```
  */
-class Cookies extends AbstractInjectionAware implements CookiesInterface
+class Cookies extends AbstractInjectionAware implements CookiesInterface, ResettableInterface
 {
     /**
      * @var array
@@ -206,6 +207,14 @@ class Cookies extends AbstractInjectionAware implements CookiesInterface
         return this;
     }
 
+    /**
+     * Removes the cookies set for the last request
+     */
+    public function resetRequest() -> void
+    {
+        this->reset();
+    }
+
     /**
      * Sends the cookies to the client
      * Cookies aren't sent if headers are sent in the current request
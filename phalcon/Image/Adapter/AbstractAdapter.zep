@@ -318,68 +318,11 @@ abstract class AbstractAdapter implements AdapterInterface
         int height = null,
         int master = Enum::AUTO
     ) -> <AdapterInterface> {
-        var ratio;
-
-        switch (master) {
-            case Enum::TENSILE:
-            case Enum::AUTO:
-            case Enum::INVERSE:
-            case Enum::PRECISE:
-                if (null === width || null === height) {
-                    throw new Exception("width and height must be specified");
-                }
-                break;
-            case Enum::WIDTH:
-                if (null === width) {
-                    throw new Exception("width must be specified");
-                }
-                break;
-            case Enum::HEIGHT:
-                if (null === height) {
-                    throw new Exception("height must be specified");
-                }
-                break;
-        }
-
-        if (master !== Enum::TENSILE) {
-            if (master === Enum::AUTO) {
-                let master = (this->width / width) > (this->height / height) ? Enum::WIDTH : Enum::HEIGHT;
-            }
-
-            if (master === Enum::INVERSE) {
-                let master = (this->width / width) > (this->height / height) ? Enum::HEIGHT : Enum::WIDTH;
-            }
-
-            switch (master) {
-                case Enum::WIDTH:
-                    let height = this->height * width / this->width;
-                    break;
-
-                case Enum::HEIGHT:
-                    let width = this->width * height / this->height;
-                    break;
-
-                case Enum::PRECISE:
-                    let ratio = this->width / this->height;
+        var dimensions;
 
-                    if ((width / height) > ratio) {
-                        let height = this->height * width / this->width;
-                    } else {
-                        let width = this->width * height / this->height;
-                    }
-                    break;
+        let dimensions = this->calculateResize(width, height, master);
 
-                case Enum::NONE:
-                    let width  = (null === width) ? this->width : width;
-                    let height = (null === height) ? this->height : height;
-                    break;
-            }
-        }
-
-        let width  = (int) max(round(width), 1);
-        let height = (int) max(round(height), 1);
-
-        this->{"processResize"}(width, height);
+        this->{"processResize"}(dimensions[0], dimensions[1]);
 
         return this;
     }
@@ -502,6 +445,177 @@ abstract class AbstractAdapter implements AdapterInterface
         return this;
     }
 
+    /**
+     * Generates several thumbnails from the loaded image. The image is
+     * decoded once, the thumbnails are produced from the largest to the
+     * smallest and each one is derived from the previous (larger) one, when
+     * it has the same aspect ratio, instead of the full size image. The
+     * loaded image is left untouched.
+     *
+     * Each specification accepts `width`, `height`, `master` (defaults to
+     * `Enum::AUTO`), `quality` and either `file` (the thumbnail is saved
+     * and the file name returned) or `extension` (the thumbnail is rendered
+     * and the binary string returned).
+     *
+     *```php
+     * $image = new \Phalcon\Image\Adapter\Imagick("upload/photo.jpg");
+     *
+     * $files = $image->thumbnails(
+     *     [
+     *         "large" => ["width" => 800, "height" => 800, "file" => "l.jpg"],
+     *         "small" => ["width" => 100, "height" => 100, "file" => "s.jpg"],
+     *         "icon"  => ["width" => 32, "master" => Enum::WIDTH, "extension" => "png"],
+     *     ]
+     * );
+     *```
+     *
+     * @param array $specs
+     *
+     * @return array The file names or rendered images, keyed as the specs
+     * @throws Exception
+     */
+    public function thumbnails(array specs) -> array
+    {
+        var dimensions, ex, extension, file, height, image, key, mime,
+            quality, skew, source, sourceHeight, sourceWidth, spec, thumbnail,
+            type, width;
+        array areas = [], results = [], sizes = [];
+
+        for key, spec in specs {
+            if unlikely typeof spec !== "array" {
+                throw new Exception("Thumbnail specification must be an array");
+            }
+
+            /**
+             * Missing dimensions are validated by calculateResize() as
+             * resize() does
+             */
+            if fetch width, spec["width"] {
+                let width = (int) width;
+            } else {
+                let width = null;
+            }
+
+            if fetch height, spec["height"] {
+                let height = (int) height;
+            } else {
+                let height = null;
+            }
+
+            let dimensions = this->calculateResize(
+                width,
+                height,
+                isset spec["master"] ? (int) spec["master"] : Enum::AUTO
+            );
+
+            let sizes[key] = dimensions,
+                areas[key] = dimensions[0] * dimensions[1];
+        }
+
+        /**
+         * Largest first, so that each thumbnail can be derived from the
+         * previous one
+         */
+        arsort(areas);
+
+        let image        = this->image,
+            width        = this->width,
+            height       = this->height,
+            type         = this->type,
+            mime         = this->mime,
+            source       = image,
+            sourceWidth  = width,
+            sourceHeight = height;
+
+        try {
+            for key in array_keys(areas) {
+                let spec       = specs[key],
+                    dimensions = sizes[key];
+
+                /**
+                 * Cannot derive from a smaller intermediate, or from one of
+                 * another aspect ratio (beyond a pixel of rounding) that
+                 * would distort the thumbnail, start again from the full
+                 * size image
+                 */
+                let skew = abs(
+                    dimensions[0] * sourceHeight - dimensions[1] * sourceWidth
+                );
+
+                if (
+                    dimensions[0] > sourceWidth ||
+                    dimensions[1] > sourceHeight ||
+                    skew > sourceWidth ||
+                    skew > sourceHeight
+                ) {
+                    let source       = image,
+                        sourceWidth  = width,
+                        sourceHeight = height;
+                }
+
+                let thumbnail = this->{"processThumbnail"}(
+                    source,
+                    dimensions[0],
+                    dimensions[1]
+                );
+
+                let this->image  = thumbnail,
+                    this->width  = dimensions[0],
+                    this->height = dimensions[1];
+
+                if !fetch quality, spec["quality"] {
+                    let quality = -1;
+                }
+
+                if fetch file, spec["file"] {
+                    this->{"processSave"}((string) file, (int) quality);
+
+                    let results[key] = file;
+                } else {
+                    if !fetch extension, spec["extension"] {
+                        let extension = (string) pathinfo(this->file, PATHINFO_EXTENSION);
+                    }
+
+                    if (true === empty(extension)) {
+                        let extension = "png";
+                    }
+
+                    if quality < 0 {
+                        let quality = 100;
+                    }
+
+                    let results[key] = this->{"processRender"}(
+                        (string) extension,
+                        this->checkHighLow((int) quality, 1)
+                    );
+                }
+
+                let source       = thumbnail,
+                    sourceWidth  = dimensions[0],
+                    sourceHeight = dimensions[1];
+            }
+        } catch \Exception, ex {
+            let this->image  = image,
+                this->width  = width,
+                this->height = height,
+                this->type   = type,
+                this->mime   = mime;
+
+            throw ex;
+        }
+
+        let this->image  = image,
+            this->width  = width,
+            this->height = height,
+            this->type   = type,
+            this->mime   = mime;
+
+        /**
+         * Keep the specification order
+         */
+        return array_replace(array_intersect_key(specs, results), results);
+    }
+
     /**
      * Add a watermark to an image with the specified opacity
      *
@@ -539,6 +653,86 @@ abstract class AbstractAdapter implements AdapterInterface
         return this;
     }
 
+    /**
+     * Returns the `[width, height]` a resize with the given parameters
+     * produces, based on the current size of the image
+     *
+     * @param int|null $width
+     * @param int|null $height
+     * @param int      $master
+     *
+     * @return array
+     * @throws Exception
+     */
+    protected function calculateResize(
+        int width = null,
+        int height = null,
+        int master = Enum::AUTO
+    ) -> array {
+        var ratio;
+
+        switch (master) {
+            case Enum::TENSILE:
+            case Enum::AUTO:
+            case Enum::INVERSE:
+            case Enum::PRECISE:
+                if (null === width || null === height) {
+                    throw new Exception("width and height must be specified");
+                }
+                break;
+            case Enum::WIDTH:
+                if (null === width) {
+                    throw new Exception("width must be specified");
+                }
+                break;
+            case Enum::HEIGHT:
+                if (null === height) {
+                    throw new Exception("height must be specified");
+                }
+                break;
+        }
+
+        if (master !== Enum::TENSILE) {
+            if (master === Enum::AUTO) {
+                let master = (this->width / width) > (this->height / height) ? Enum::WIDTH : Enum::HEIGHT;
+            }
+
+            if (master === Enum::INVERSE) {
+                let master = (this->width / width) > (this->height / height) ? Enum::HEIGHT : Enum::WIDTH;
+            }
+
+            switch (master) {
+                case Enum::WIDTH:
+                    let height = this->height * width / this->width;
+                    break;
+
+                case Enum::HEIGHT:
+                    let width = this->width * height / this->height;
+                    break;
+
+                case Enum::PRECISE:
+                    let ratio = this->width / this->height;
+
+                    if ((width / height) > ratio) {
+                        let height = this->height * width / this->width;
+                    } else {
+                        let width = this->width * height / this->height;
+                    }
+                    break;
+
+                case Enum::NONE:
+                    let width  = (null === width) ? this->width : width;
+                    let height = (null === height) ? this->height : height;
+                    break;
+            }
+        }
+
+        let width  = (int) max(round(width), 1);
+        let height = (int) max(round(height), 1);
+
+        return [width, height];
+    }
+
     /**
      * @param int $value
      * @param int $min
@@ -826,6 +826,26 @@ class Gd extends AbstractAdapter
         }
     }
 
+    /**
+     * Returns a scaled copy of an image, leaving the source untouched
+     *
+     * @param mixed $image
+     * @param int   $width
+     * @param int   $height
+     *
+     * @return mixed
+     */
+    protected function processThumbnail(var image, int width, int height)
+    {
+        var thumbnail;
+
+        let thumbnail = imagescale(image, width, height);
+
+        imagesavealpha(thumbnail, true);
+
+        return thumbnail;
+    }
+
     protected function processWatermark(
         <AdapterInterface> watermark,
         int offsetX,
@@ -849,6 +849,36 @@ class Imagick extends AbstractAdapter
         draw->destroy();
     }
 
+    /**
+     * Returns a scaled copy of an image, leaving the source untouched. The
+     * threads used by ImageMagick can be limited with setResourceLimit()
+     * and `Imagick::RESOURCETYPE_THREAD`
+     *
+     * @param ImagickNative $image
+     * @param int           $width
+     * @param int           $height
+     *
+     * @return ImagickNative
+     * @throws ImagickException
+     */
+    protected function processThumbnail(var image, int width, int height) -> <ImagickNative>
+    {
+        var thumbnail;
+
+        let thumbnail = clone image;
+        thumbnail->setIteratorIndex(0);
+
+        while (true) {
+            thumbnail->thumbnailImage(width, height);
+
+            if (true !== thumbnail->nextImage()) {
+                break;
+            }
+        }
+
+        return thumbnail;
+    }
+
     /**
      * Add Watermark
      *
@@ -10,6 +10,7 @@
 
 namespace Phalcon\Logger;
 
+use Closure;
 use DateTimeImmutable;
 use DateTimeZone;
 use Exception;
@@ -25,6 +26,7 @@ use Phalcon\Logger\Adapter\AdapterInterface;
  * developers to create new instances of the Logger or load them from config
  * files (see Phalcon\Config\Config object).
  *
+ * @property array              $adapterLevels
  * @property AdapterInterface[] $adapters
  * @property array              $excluded
  * @property int                $logLevel
@@ -43,6 +45,13 @@ abstract class AbstractLogger
     const NOTICE    = 5;
     const WARNING   = 4;
 
+    /**
+     * Minimum log level of each adapter
+     *
+     * @var array
+     */
+    protected adapterLevels = [];
+
     /**
      * The adapter stack
      *
@@ -172,6 +181,25 @@ abstract class AbstractLogger
         return this->adapters[name];
     }
 
+    /**
+     * Returns the minimum log level of an adapter. Defaults to the log level
+     * of the logger
+     *
+     * @param string $name The name of the adapter
+     *
+     * @return int
+     */
+    public function getAdapterLogLevel(string name) -> int
+    {
+        var level;
+
+        if fetch level, this->adapterLevels[name] {
+            return level;
+        }
+
+        return this->logLevel;
+    }
+
     /**
      * Returns the adapter stack array
      *
@@ -215,6 +243,34 @@ abstract class AbstractLogger
         }
 
         unset(this->adapters[name]);
+        unset(this->adapterLevels[name]);
+
+        return this;
+    }
+
+    /**
+     * Sets the minimum log level of an adapter. Messages above it are not
+     * sent to the adapter, and are not built at all if no adapter accepts
+     * them
+     *
+     * @param string $name  The name of the adapter
+     * @param int    $level
+     *
+     * @return AbstractLogger
+     * @throws LoggerException
+     */
+    public function setAdapterLogLevel(string name, int level) -> <AbstractLogger>
+    {
+        var levels;
+
+        if (true !== isset(this->adapters[name])) {
+            throw new LoggerException(
+                "Adapter does not exist for this logger"
+            );
+        }
+
+        let levels                    = this->getLevels(),
+            this->adapterLevels[name] = true === isset(levels[level]) ? level : self::CUSTOM;
 
         return this;
     }
@@ -252,11 +308,13 @@ abstract class AbstractLogger
 
 
     /**
-     * Adds a message to each handler for processing
+     * Adds a message to each handler for processing. The adapters that accept
+     * the level are selected first, so nothing is built if none of them
+     * does. A closure passed as the message is only called at that point
      *
-     * @param int    level
-     * @param string $message
-     * @param array  $context
+     * @param int            $level
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return bool
      * @throws Exception
@@ -264,31 +322,57 @@ abstract class AbstractLogger
      */
     protected function addMessage(
         int level,
-        string message,
+        var message,
         array context = []
     ) -> bool {
-        var adapter, collection, item, levelName, levels, method;
+        var adapter, adapterLevel, collection, item, levelName, levels, method,
+            name;
+        array emitting;
+
         if (this->logLevel >= level) {
             if (count(this->adapters) === 0) {
                 throw new LoggerException("No adapters specified");
             }
 
+            /**
+             * Log only if the key does not exist in the excluded ones and
+             * the adapter accepts the level. Clear the excluded array since
+             * we made the call now
+             */
+            let collection     = array_diff_key(this->adapters, this->excluded),
+                this->excluded = [],
+                emitting       = [];
+
+            for name, adapter in collection {
+                if fetch adapterLevel, this->adapterLevels[name] {
+                    if adapterLevel < level {
+                        continue;
+                    }
+                }
+
+                let emitting[name] = adapter;
+            }
+
+            if (count(emitting) === 0) {
+                return true;
+            }
+
+            if (message instanceof Closure) {
+                let message = call_user_func(message);
+            }
+
             let levels    = this->getLevels(),
                 levelName = true === isset(levels[level]) ? levels[level] : levels[self::CUSTOM];
 
             let item = new Item(
-                message,
+                (string) message,
                 levelName,
                 level,
                 new DateTimeImmutable("now", this->timezone),
                 context
             );
 
-            /**
-             * Log only if the key does not exist in the excluded ones
-             */
-            let collection = array_diff_key(this->adapters, this->excluded);
-            for adapter in collection {
+            for adapter in emitting {
                 let method = "process";
                 if (true === adapter->inTransaction()) {
                     let method = "add";
@@ -296,11 +380,6 @@ abstract class AbstractLogger
 
                 adapter->{method}(item);
             }
-
-            /**
-             * Clear the excluded array since we made the call now
-             */
-            let this->excluded = [];
         }
 
         return true;
@@ -11,6 +11,7 @@
 namespace Phalcon\Logger\Adapter;
 
 use Phalcon\Logger\Exception;
+use Phalcon\Logger\Formatter\AbstractFormatter;
 use Phalcon\Logger\Formatter\FormatterInterface;
 use Phalcon\Logger\Formatter\Line;
 use Phalcon\Logger\Item;
@@ -191,15 +192,35 @@ abstract class AbstractAdapter implements AdapterInterface
     }
 
     /**
-     * Returns the formatted item
+     * Returns the formatted item. The result is stored in the item, so that
+     * adapters with the same formatter configuration format it once.
+     * Formatters without a configuration key format it every time
      */
     protected function getFormattedItem(<Item> item) -> string
     {
-        var formatter;
+        var formatted, formatter, key;
 
         let formatter = this->getFormatter();
 
-        return formatter->format(item);
+        if !(formatter instanceof AbstractFormatter) {
+            return formatter->format(item);
+        }
+
+        let key = formatter->getConfigurationKey();
+
+        if key === null {
+            return formatter->format(item);
+        }
+
+        let formatted = item->getFormatted(key);
+
+        if null === formatted {
+            let formatted = formatter->format(item);
+
+            item->setFormatted(key, formatted);
+        }
+
+        return formatted;
     }
 
     /**
@@ -0,0 +1,361 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Logger\Adapter;
+
+use Phalcon\Logger\Exception;
+use Phalcon\Logger\Item;
+
+/**
+ * Phalcon\Logger\Adapter\Datagram
+ *
+ * Adapter that ships logs to a local collector over a UDP or Unix datagram
+ * socket without blocking the request.
+ *
+ * Formatted lines are stored in a bounded ring buffer. The buffer is drained
+ * at shutdown or when `close()` is called. Lines are sent in batches of up
+ * to `packetSize` bytes, one per datagram. When the buffer is full, or a
+ * datagram cannot be written, the lines are dropped and counted.
+ *
+ * With the `finishRequest` option, `fastcgi_finish_request()` is called
+ * before draining at shutdown, so that the response has already been sent.
+ * The output of the shutdown functions registered afterwards is then lost.
+ *
+ *```php
+ * $logger = new \Phalcon\Logger\Adapter\Datagram(
+ *     'udp://127.0.0.1:5140',
+ *     [
+ *         'capacity'      => 1024,
+ *         'packetSize'    => 8192,
+ *         'finishRequest' => false,
+ *     ]
+ * );
+ *
+ * $logger = new \Phalcon\Logger\Adapter\Datagram('unix:///run/collector.sock');
+ *```
+ *
+ * @property string        $address
+ * @property array         $buffer
+ * @property int           $capacity
+ * @property int           $count
+ * @property int           $dropped
+ * @property bool          $finishRequest
+ * @property int           $head
+ * @property int           $packetSize
+ * @property bool          $registered
+ * @property resource|null $socket
+ */
+class Datagram extends AbstractAdapter
+{
+    /**
+     * Socket address, `unix://` addresses are opened as `udg://`
+     *
+     * @var string
+     */
+    protected address;
+
+    /**
+     * Ring buffer of formatted lines
+     *
+     * @var array
+     */
+    protected buffer = [];
+
+    /**
+     * Maximum number of buffered lines. Defaults to 1024
+     *
+     * @var int
+     */
+    protected capacity = 1024;
+
+    /**
+     * Number of buffered lines
+     *
+     * @var int
+     */
+    protected count = 0;
+
+    /**
+     * Number of lines dropped
+     *
+     * @var int
+     */
+    protected dropped = 0;
+
+    /**
+     * Call `fastcgi_finish_request()` before draining at shutdown. Defaults
+     * to false
+     *
+     * @var bool
+     */
+    protected finishRequest = false;
+
+    /**
+     * Position of the oldest line in the ring buffer
+     *
+     * @var int
+     */
+    protected head = 0;
+
+    /**
+     * Maximum size of a datagram. Defaults to 8192
+     *
+     * @var int
+     */
+    protected packetSize = 8192;
+
+    /**
+     * Whether the shutdown function has been registered
+     *
+     * @var bool
+     */
+    protected registered = false;
+
+    /**
+     * @var resource|null
+     */
+    protected socket = null;
+
+    /**
+     * Datagram constructor.
+     *
+     * @param string $address
+     * @param array  $options
+     *
+     * @throws Exception
+     */
+    public function __construct(string address, array options = [])
+    {
+        var value;
+
+        if starts_with(address, "unix://") {
+            let address = "udg://" . substr(address, 7);
+        }
+
+        if unlikely (
+            !starts_with(address, "udp://") &&
+            !starts_with(address, "udg://")
+        ) {
+            throw new Exception(
+                "The address must be a udp:// or unix:// datagram socket"
+            );
+        }
+
+        let this->address = address;
+
+        if fetch value, options["capacity"] {
+            let this->capacity = max(1, (int) value);
+        }
+
+        if fetch value, options["packetSize"] {
+            let this->packetSize = max(1, (int) value);
+        }
+
+        if fetch value, options["finishRequest"] {
+            let this->finishRequest = (bool) value;
+        }
+    }
+
+    /**
+     * Sends the buffered lines and closes the socket
+     */
+    public function close() -> bool
+    {
+        var socket;
+
+        this->drain();
+
+        let socket       = this->socket,
+            this->socket = null;
+
+        if is_resource(socket) {
+            return fclose(socket);
+        }
+
+        return true;
+    }
+
+    /**
+     * Sends the buffered lines. Returns the number of lines sent, the lines
+     * of the datagrams that could not be written are counted as dropped
+     *
+     * @param bool $finishRequest
+     *
+     * @return int
+     */
+    public function drain(bool finishRequest = false) -> int
+    {
+        var line, packet;
+        int lines = 0, sent = 0;
+
+        if this->count < 1 {
+            return 0;
+        }
+
+        if (
+            finishRequest &&
+            this->finishRequest &&
+            function_exists("fastcgi_finish_request")
+        ) {
+            fastcgi_finish_request();
+        }
+
+        if !is_resource(this->socket) {
+            let this->socket = this->phpStreamSocketClient(this->address);
+
+            if !is_resource(this->socket) {
+                let this->socket   = null,
+                    this->dropped += this->count;
+
+                this->resetBuffer();
+
+                return 0;
+            }
+
+            stream_set_blocking(this->socket, false);
+        }
+
+        /**
+         * A send can fail if the collector is down, there is nothing the
+         * request can do about it
+         */
+        set_error_handler(
+            function (number, message, file, line) {
+                return true;
+            }
+        );
+
+        let packet = "";
+
+        while this->count > 0 {
+            let line       = this->buffer[this->head],
+                this->head = (this->head + 1) % this->capacity,
+                this->count--;
+
+            if strlen(line) > this->packetSize {
+                let line = substr(line, 0, this->packetSize);
+            }
+
+            if packet !== "" && strlen(packet) + strlen(line) > this->packetSize {
+                let sent  += this->send(packet, lines),
+                    packet = "",
+                    lines  = 0;
+            }
+
+            let packet .= line,
+                lines++;
+        }
+
+        if packet !== "" {
+            let sent += this->send(packet, lines);
+        }
+
+        restore_error_handler();
+
+        this->resetBuffer();
+
+        return sent;
+    }
+
+    /**
+     * Returns the number of buffered lines
+     *
+     * @return int
+     */
+    public function getCount() -> int
+    {
+        return this->count;
+    }
+
+    /**
+     * Returns the number of lines dropped because the buffer was full, the
+     * socket could not be opened or a datagram could not be written
+     *
+     * @return int
+     */
+    public function getDropped() -> int
+    {
+        return this->dropped;
+    }
+
+    /**
+     * Processes the message i.e. stores it in the buffer
+     *
+     * @param Item $item
+     */
+    public function process(<Item> item) -> void
+    {
+        if this->count >= this->capacity {
+            let this->dropped++;
+
+            return;
+        }
+
+        let this->buffer[(this->head + this->count) % this->capacity] = this->getFormattedItem(item) . PHP_EOL,
+            this->count++;
+
+        if !this->registered {
+            register_shutdown_function(
+                [
+                    this,
+                    "drain"
+                ],
+                true
+            );
+
+            let this->registered = true;
+        }
+    }
+
+    /**
+     * @todo to be removed when we get traits
+     */
+    protected function phpStreamSocketClient(string address)
+    {
+        var errorCode, errorMessage;
+
+        return stream_socket_client(address, errorCode, errorMessage, 0);
+    }
+
+    /**
+     * Empties the ring buffer
+     */
+    private function resetBuffer() -> void
+    {
+        let this->buffer = [],
+            this->count  = 0,
+            this->head   = 0;
+    }
+
+    /**
+     * Sends one datagram and returns the number of lines sent. A failed or
+     * short write, which happens when the socket buffer is full, drops the
+     * lines of the datagram
+     *
+     * @param string $packet
+     * @param int    $lines
+     *
+     * @return int
+     */
+    private function send(string packet, int lines) -> int
+    {
+        var written;
+
+        let written = fwrite(this->socket, packet);
+
+        if written === false || written < strlen(packet) {
+            let this->dropped += lines;
+
+            return 0;
+        }
+
+        return lines;
+    }
+}
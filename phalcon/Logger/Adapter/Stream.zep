@@ -19,6 +19,13 @@ use Phalcon\Logger\Item;
  *
  * Adapter to store logs in plain text files
  *
+ * The file is opened once and kept open until `close()` is called or the
+ * adapter is destroyed. Formatted lines can be buffered with the
+ * `bufferLines` and `bufferSize` options; a transaction is always written
+ * with one call. Each batch is written with a single `fwrite()` on a stream
+ * opened in append mode, so lines of concurrent processes do not interleave
+ * without having to lock the file.
+ *
  *```php
  * $logger = new \Phalcon\Logger\Adapter\Stream('app/logs/test.log');
  *
@@ -27,14 +34,62 @@ use Phalcon\Logger\Item;
  * $logger->error('This is another error');
  *
  * $logger->close();
+ *
+ * $logger = new \Phalcon\Logger\Adapter\Stream(
+ *     'app/logs/test.log',
+ *     [
+ *         'bufferLines' => 100,
+ *         'bufferSize'  => 65536,
+ *     ]
+ * );
  *```
  *
+ * @property array         $buffer
+ * @property int           $bufferLength
+ * @property int           $bufferLines
+ * @property int           $bufferSize
+ * @property resource|null $handler
  * @property string        $mode
  * @property string        $name
  * @property array         $options
  */
 class Stream extends AbstractAdapter
 {
+    /**
+     * Formatted lines waiting to be written
+     *
+     * @var array
+     */
+    protected buffer = [];
+
+    /**
+     * Length in bytes of the buffered lines
+     *
+     * @var int
+     */
+    protected bufferLength = 0;
+
+    /**
+     * Number of lines to buffer before writing. Defaults to 1 (no buffering)
+     *
+     * @var int
+     */
+    protected bufferLines = 1;
+
+    /**
+     * Bytes to buffer before writing. Defaults to 65536
+     *
+     * @var int
+     */
+    protected bufferSize = 65536;
+
+    /**
+     * The open stream
+     *
+     * @var resource|null
+     */
+    protected handler = null;
+
     /**
      * The file open mode. Defaults to 'ab'
      *
@@ -76,18 +131,73 @@ class Stream extends AbstractAdapter
             throw new Exception("Adapter cannot be opened in read mode");
         }
 
-        let this->name = name,
-            this->mode = mode;
+        let this->name    = name,
+            this->mode    = mode,
+            this->options = options;
+
+        if isset options["bufferLines"] {
+            let this->bufferLines = max(1, (int) options["bufferLines"]);
+        }
+
+        if isset options["bufferSize"] {
+            let this->bufferSize = max(0, (int) options["bufferSize"]);
+        }
     }
 
     /**
-     * Closes the stream
+     * Writes the buffered lines and closes the stream
      */
     public function close() -> bool
     {
+        var handler;
+
+        this->flush();
+
+        let handler       = this->handler,
+            this->handler = null;
+
+        if is_resource(handler) {
+            return fclose(handler);
+        }
+
         return true;
     }
 
+    /**
+     * Commits the internal transaction, writing all the queued lines at once
+     *
+     * @return AdapterInterface
+     * @throws Exception
+     */
+    public function commit() -> <AdapterInterface>
+    {
+        parent::commit();
+
+        this->flush();
+
+        return this;
+    }
+
+    /**
+     * Writes the buffered lines with one call
+     *
+     * @return void
+     */
+    public function flush() -> void
+    {
+        var message;
+
+        if empty this->buffer {
+            return;
+        }
+
+        let message            = implode("", this->buffer),
+            this->buffer       = [],
+            this->bufferLength = 0;
+
+        fwrite(this->getHandler(), message);
+    }
+
     /**
      * Stream name
      *
@@ -99,13 +209,39 @@ class Stream extends AbstractAdapter
     }
 
     /**
-     * Processes the message i.e. writes it to the file
+     * Processes the message i.e. buffers it and writes the buffer to the
+     * file when it is full. In a transaction the lines are written at commit
      *
      * @param Item $item
      */
     public function process(<Item> item) -> void
     {
-        var handler, message;
+        var message;
+
+        let message             = this->getFormattedItem(item) . PHP_EOL,
+            this->buffer[]      = message,
+            this->bufferLength += strlen(message);
+
+        if (
+            this->bufferLength >= this->bufferSize ||
+            (!this->inTransaction && count(this->buffer) >= this->bufferLines)
+        ) {
+            this->flush();
+        }
+    }
+
+    /**
+     * Returns the open stream, opening it if needed
+     *
+     * @return resource
+     */
+    protected function getHandler()
+    {
+        var handler;
+
+        if is_resource(this->handler) {
+            return this->handler;
+        }
 
         let handler = this->phpFopen(this->name, this->mode);
 
@@ -119,14 +255,9 @@ class Stream extends AbstractAdapter
             );
         }
 
-        /**
-         * Not much we can do about locking
-         */
-        flock(handler, LOCK_EX);
-        let message = this->getFormattedItem(item) . PHP_EOL;
-        fwrite(handler, message);
+        let this->handler = handler;
 
-        fclose(handler);
+        return handler;
     }
 
     /**
@@ -74,9 +74,10 @@ class AdapterFactory extends AbstractFactory
     protected function getServices() -> array
     {
         return [
-            "noop"   : "Phalcon\\Logger\\Adapter\\Noop",
-            "stream" : "Phalcon\\Logger\\Adapter\\Stream",
-            "syslog" : "Phalcon\\Logger\\Adapter\\Syslog"
+            "datagram" : "Phalcon\\Logger\\Adapter\\Datagram",
+            "noop"     : "Phalcon\\Logger\\Adapter\\Noop",
+            "stream"   : "Phalcon\\Logger\\Adapter\\Stream",
+            "syslog"   : "Phalcon\\Logger\\Adapter\\Syslog"
         ];
     }
 }
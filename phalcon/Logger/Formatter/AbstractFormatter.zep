@@ -36,6 +36,37 @@ abstract class AbstractFormatter extends AbstractStr implements FormatterInterfa
      */
     protected interpolatorRight = "%";
 
+    /**
+     * Returns a key identifying the configuration of the formatter. Items
+     * formatted by formatters with the same key are formatted once and
+     * shared between adapters.
+     *
+     * Only the formatters of this namespace have a key. Subclasses may hold
+     * options the key does not know about, so they return null and their
+     * items are formatted every time, unless they override this method to
+     * include their options
+     *
+     * @return string|null
+     */
+    public function getConfigurationKey() -> string | null
+    {
+        var className;
+
+        let className = get_class(this);
+
+        if (
+            className !== "Phalcon\\Logger\\Formatter\\Json" &&
+            className !== "Phalcon\\Logger\\Formatter\\Line"
+        ) {
+            return null;
+        }
+
+        return className .
+            "|" . this->dateFormat .
+            "|" . this->interpolatorLeft .
+            "|" . this->interpolatorRight;
+    }
+
     /**
      * @return string
      */
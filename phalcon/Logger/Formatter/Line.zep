@@ -69,6 +69,25 @@ class Line extends AbstractFormatter
         return this->getInterpolatedMessage(item, message);
     }
 
+    /**
+     * Returns a key identifying the configuration of the formatter, null for
+     * subclasses
+     *
+     * @return string|null
+     */
+    public function getConfigurationKey() -> string | null
+    {
+        var key;
+
+        let key = parent::getConfigurationKey();
+
+        if key === null {
+            return null;
+        }
+
+        return key . "|" . this->format;
+    }
+
     /**
      * Return the format applied to each message
      *
@@ -22,6 +22,7 @@ use DateTimeImmutable;
  * @property int               $level
  * @property string            $levelName
  * @property DateTimeImmutable $datetime
+ * @property array             $formatted
  */
 class Item
 {
@@ -35,6 +36,13 @@ class Item
      */
     protected dateTime;
 
+    /**
+     * Formatted message per formatter configuration
+     *
+     * @var array
+     */
+    protected formatted = [];
+
     /**
      * @var string
      */
@@ -89,6 +97,25 @@ class Item
         return this->dateTime;
     }
 
+    /**
+     * Returns the message formatted by a formatter with the given
+     * configuration key, if any
+     *
+     * @param string $key
+     *
+     * @return string|null
+     */
+    public function getFormatted(string key) -> string | null
+    {
+        var formatted;
+
+        if fetch formatted, this->formatted[key] {
+            return formatted;
+        }
+
+        return null;
+    }
+
     /**
      * @return string
      */
@@ -112,4 +139,18 @@ class Item
     {
         return this->levelName;
     }
+
+    /**
+     * Stores the message formatted by a formatter with the given
+     * configuration key
+     *
+     * @param string $key
+     * @param string $formatted
+     *
+     * @return void
+     */
+    public function setFormatted(string key, string formatted) -> void
+    {
+        let this->formatted[key] = formatted;
+    }
 }
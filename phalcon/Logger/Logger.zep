@@ -10,6 +10,7 @@
 
 namespace Phalcon\Logger;
 
+use Closure;
 use Exception;
 use Phalcon\Logger\Exception as LoggerException;
 
@@ -30,14 +31,14 @@ class Logger extends AbstractLogger implements LoggerInterface
      * Example: Entire website down, database unavailable, etc. This should
      * trigger the SMS alerts and wake you up.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function alert(string message, array context = []) -> void
+    public function alert(var message, array context = []) -> void
     {
         this->addMessage(self::ALERT, message, context);
     }
@@ -47,14 +48,14 @@ class Logger extends AbstractLogger implements LoggerInterface
      *
      * Example: Application component unavailable, unexpected exception.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function critical(string message, array context = []) -> void
+    public function critical(var message, array context = []) -> void
     {
         this->addMessage(self::CRITICAL, message, context);
     }
@@ -62,14 +63,14 @@ class Logger extends AbstractLogger implements LoggerInterface
     /**
      * Detailed debug information.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function debug(string message, array context = []) -> void
+    public function debug(var message, array context = []) -> void
     {
         this->addMessage(self::DEBUG, message, context);
     }
@@ -77,14 +78,14 @@ class Logger extends AbstractLogger implements LoggerInterface
     /**
      * System is unusable.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function emergency(string message, array context = []) -> void
+    public function emergency(var message, array context = []) -> void
     {
         this->addMessage(self::EMERGENCY, message, context);
     }
@@ -93,14 +94,14 @@ class Logger extends AbstractLogger implements LoggerInterface
      * Runtime errors that do not require immediate action but should typically
      * be logged and monitored.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function error(string message, array context = []) -> void
+    public function error(var message, array context = []) -> void
     {
         this->addMessage(self::ERROR, message, context);
     }
@@ -110,14 +111,14 @@ class Logger extends AbstractLogger implements LoggerInterface
      *
      * Example: User logs in, SQL logs.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function info(string message, array context = []) -> void
+    public function info(var message, array context = []) -> void
     {
         this->addMessage(self::INFO, message, context);
     }
@@ -126,33 +127,33 @@ class Logger extends AbstractLogger implements LoggerInterface
      * Logs with an arbitrary level.
      *
      * @param mixed  $level
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function log(var level, string message, array context = []) -> void
+    public function log(var level, var message, array context = []) -> void
     {
         var intLevel;
 
         let intLevel = this->getLevelNumber(level);
 
-        this->addMessage(intLevel, (string) message, context);
+        this->addMessage(intLevel, message, context);
     }
 
     /**
      * Normal but significant events.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function notice(string message, array context = []) -> void
+    public function notice(var message, array context = []) -> void
     {
         this->addMessage(self::NOTICE, message, context);
     }
@@ -163,14 +164,14 @@ class Logger extends AbstractLogger implements LoggerInterface
      * Example: Use of deprecated APIs, poor use of an API, undesirable things
      * that are not necessarily wrong.
      *
-     * @param string $message
-     * @param array  $context
+     * @param string|Closure $message
+     * @param array          $context
      *
      * @return void
      * @throws Exception
      * @throws LoggerException
      */
-    public function warning(string message, array context = []) -> void
+    public function warning(var message, array context = []) -> void
     {
         this->addMessage(self::WARNING, message, context);
     }
@@ -41,6 +41,7 @@ class LoggerFactory extends AbstractConfigFactory
      *         'adapter-name' => [
      *              'adapter' => 'stream',
      *              'name'    => 'file.log',
+     *              'level'   => Logger::ERROR,
      *              'options' => [
      *                  'mode'     => 'ab',
      *                  'option'   => null,
@@ -52,11 +53,12 @@ class LoggerFactory extends AbstractConfigFactory
      */
     public function load(var config) -> <Logger>
     {
-        var adapter, adapterClass, adapterFileName, adapterName, adapterOptions,
-            adapters, name, timezone, options;
-        array data;
+        var adapter, adapterClass, adapterFileName, adapterLevel, adapterName,
+            adapterOptions, adapters, logger, name, timezone, options;
+        array data, levels;
 
         let data     = [],
+            levels   = [],
             config   = this->checkConfig(config),
             config   = this->checkConfigElement(config, "name"),
             name     = config["name"],
@@ -69,16 +71,27 @@ class LoggerFactory extends AbstractConfigFactory
         for adapterName, adapter in adapters {
             let adapterClass    = this->getArrVal(adapter, "adapter"),
                 adapterFileName = this->getArrVal(adapter, "name"),
-                adapterOptions  = this->getArrVal(adapter, "options", []);
+                adapterOptions  = this->getArrVal(adapter, "options", []),
+                adapterLevel    = this->getArrVal(adapter, "level");
 
             let data[adapterName] = this->adapterFactory->newInstance(
                 adapterClass,
                 adapterFileName,
                 adapterOptions
             );
+
+            if null !== adapterLevel {
+                let levels[adapterName] = adapterLevel;
+            }
+        }
+
+        let logger = this->newInstance(name, data, timezone);
+
+        for adapterName, adapterLevel in levels {
+            logger->setAdapterLogLevel(adapterName, adapterLevel);
         }
 
-        return this->newInstance(name, data, timezone);
+        return logger;
     }
 
     /**
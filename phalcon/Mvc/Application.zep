@@ -12,6 +12,7 @@ namespace Phalcon\Mvc;
 
 use Closure;
 use Phalcon\Application\AbstractApplication;
+use Phalcon\Di\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Http\ResponseInterface;
 use Phalcon\Events\ManagerInterface;
@@ -417,6 +418,32 @@ class Application extends AbstractApplication
         return response;
     }
 
+    /**
+     * Handles a MVC request in a long running process (RoadRunner, Swoole,
+     * FrankenPHP workers). The state that the components kept from the
+     * previous request is reset first, and the shared instances of
+     * `services` are removed to be created again
+     *
+     * ```php
+     * while ($request = $worker->waitRequest()) {
+     *     $response = $application->handleRequest(
+     *         $request->getUri(),
+     *         [
+     *             "session",
+     *         ]
+     *     );
+     * }
+     * ```
+     */
+    public function handleRequest(string! uri, array services = []) -> <ResponseInterface> | bool
+    {
+        if this->container instanceof Di {
+            this->container->resetRequestScope(services);
+        }
+
+        return this->handle(uri);
+    }
+
     /**
      * Enables or disables sending cookies by each request handling
      */
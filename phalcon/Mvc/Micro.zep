@@ -21,6 +21,8 @@ use Phalcon\Mvc\Micro\Collection;
 use Phalcon\Mvc\Micro\LazyLoader;
 use Phalcon\Http\ResponseInterface;
 use Phalcon\Mvc\Model\BinderInterface;
+use Phalcon\Mvc\Router\Group;
+use Phalcon\Mvc\Router\GroupInterface;
 use Phalcon\Mvc\Router\RouteInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
@@ -325,6 +327,105 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
         return this->returnedValue;
     }
 
+    /**
+     * Returns the routes mapped to handlers as an array that can be exported
+     * with `var_export()` and passed to `loadRouteManifest()`, so that a
+     * later request does not need to map the routes or mount the collections
+     * again. The paths, converters, beforeMatch callbacks and groups of the
+     * routes are exported with them. Handlers must be static callables or
+     * handlers of lazy collections, and converters and beforeMatch callbacks
+     * static callables
+     *
+     *```php
+     * file_put_contents(
+     *     "routes.php",
+     *     "<?php return " . var_export($app->getRouteManifest(), true) . ";"
+     * );
+     *```
+     */
+    public function getRouteManifest() -> array
+    {
+        var beforeMatch, converter, converters, group, groupId, handler, part,
+            pattern, route, routeId;
+        array groups, manifest;
+
+        let manifest = [],
+            groups   = [];
+
+        for route in this->getRouter()->getRoutes() {
+            let routeId = route->getRouteId();
+
+            if !fetch handler, this->handlers[routeId] {
+                continue;
+            }
+
+            let pattern = route->getPattern();
+
+            if typeof handler === "array" && isset handler[0] && handler[0] instanceof LazyLoader {
+                let handler = [
+                    "lazy"       : true,
+                    "definition" : handler[0]->getDefinition(),
+                    "method"     : handler[1]
+                ];
+            } elseif unlikely !this->isExportable(handler) {
+                throw new Exception(
+                    "The handler of the route '" . pattern . "' cannot be exported"
+                );
+            }
+
+            let converters = route->getConverters();
+
+            for part, converter in converters {
+                if unlikely !this->isExportable(converter) {
+                    throw new Exception(
+                        "The converter of '" . part . "' in the route '" . pattern . "' cannot be exported"
+                    );
+                }
+            }
+
+            let beforeMatch = route->getBeforeMatch();
+
+            if unlikely beforeMatch !== null && !this->isExportable(beforeMatch) {
+                throw new Exception(
+                    "The beforeMatch callback of the route '" . pattern . "' cannot be exported"
+                );
+            }
+
+            /**
+             * The routes of a group share it again once loaded
+             */
+            let group = route->getGroup();
+
+            if group !== null {
+                let groupId = spl_object_id(group);
+
+                if !isset groups[groupId] {
+                    let groups[groupId] = this->exportGroup(
+                        group,
+                        count(groups),
+                        pattern
+                    );
+                }
+
+                let group = groups[groupId];
+            }
+
+            let manifest[] = [
+                "pattern"     : pattern,
+                "paths"       : route->getPaths(),
+                "methods"     : route->getHttpMethods(),
+                "name"        : route->getName(),
+                "hostname"    : route->getHostname(),
+                "converters"  : converters,
+                "beforeMatch" : beforeMatch,
+                "group"       : group,
+                "handler"     : handler
+            ];
+        }
+
+        return manifest;
+    }
+
     /**
      * Returns the internal router used by the application
      */
@@ -829,6 +930,75 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
         return route;
     }
 
+    /**
+     * Maps the routes of a manifest returned by `getRouteManifest()`. The
+     * handlers of lazy collections are instantiated when one of their routes
+     * is matched, once per class
+     *
+     *```php
+     * $app->loadRouteManifest(require "routes.php");
+     *```
+     */
+    public function loadRouteManifest(array manifest) -> <Micro>
+    {
+        var converter, definition, entry, group, groups, handler, loaders,
+            part, route, router;
+
+        let router  = this->getRouter(),
+            loaders = [],
+            groups  = [];
+
+        for entry in manifest {
+            let handler = entry["handler"];
+
+            if typeof handler === "array" && isset handler["lazy"] {
+                let definition = handler["definition"];
+
+                if !isset loaders[definition] {
+                    let loaders[definition] = new LazyLoader(definition);
+                }
+
+                let handler = [loaders[definition], handler["method"]];
+            }
+
+            let route = router->add(
+                entry["pattern"],
+                entry["paths"],
+                entry["methods"]
+            );
+
+            if entry["name"] !== null {
+                route->setName(entry["name"]);
+            }
+
+            if entry["hostname"] !== null {
+                route->setHostname(entry["hostname"]);
+            }
+
+            for part, converter in entry["converters"] {
+                route->convert(part, converter);
+            }
+
+            if entry["beforeMatch"] !== null {
+                route->beforeMatch(entry["beforeMatch"]);
+            }
+
+            let group = entry["group"];
+
+            if group !== null {
+                if !isset groups[group["id"]] {
+                    let groups[group["id"]] = this->importGroup(group);
+                }
+
+                route->setGroup(groups[group["id"]]);
+            }
+
+            let this->handlers[route->getRouteId()] = handler;
+        }
+
+        return this;
+    }
+
     /**
      * Maps a route to a handler without any HTTP method constraint
      *
@@ -1205,4 +1375,70 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
     {
         let this->stopped = true;
     }
+
+    /**
+     * Returns the exportable definition of a group of routes
+     */
+    protected function exportGroup(<GroupInterface> group, int id, string pattern) -> array
+    {
+        var beforeMatch;
+
+        let beforeMatch = group->getBeforeMatch();
+
+        if unlikely beforeMatch !== null && !this->isExportable(beforeMatch) {
+            throw new Exception(
+                "The beforeMatch callback of the group of the route '" . pattern . "' cannot be exported"
+            );
+        }
+
+        return [
+            "id"          : id,
+            "prefix"      : group->getPrefix(),
+            "hostname"    : group->getHostname(),
+            "paths"       : group->getPaths(),
+            "beforeMatch" : beforeMatch
+        ];
+    }
+
+    /**
+     * Creates a group of routes from its exported definition
+     */
+    protected function importGroup(array definition) -> <GroupInterface>
+    {
+        var group;
+
+        let group = new Group(definition["paths"]);
+
+        if definition["prefix"] !== null {
+            group->setPrefix(definition["prefix"]);
+        }
+
+        if definition["hostname"] !== null {
+            group->setHostname(definition["hostname"]);
+        }
+
+        if definition["beforeMatch"] !== null {
+            group->beforeMatch(definition["beforeMatch"]);
+        }
+
+        return group;
+    }
+
+    /**
+     * Checks if a callback can be exported: a function name or a static
+     * `[class, method]` callable
+     */
+    protected function isExportable(var callback) -> bool
+    {
+        if typeof callback === "string" {
+            return true;
+        }
+
+        return typeof callback === "array" &&
+            count(callback) === 2 &&
+            isset callback[0] &&
+            isset callback[1] &&
+            typeof callback[0] === "string" &&
+            typeof callback[1] === "string";
+    }
 }
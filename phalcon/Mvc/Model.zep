@@ -26,6 +26,7 @@ use Phalcon\Mvc\Model\BehaviorInterface;
 use Phalcon\Mvc\Model\Criteria;
 use Phalcon\Mvc\Model\CriteriaInterface;
 use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Mvc\Model\MetaDataInterface;
 use Phalcon\Mvc\Model\Query;
@@ -104,11 +105,25 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     protected dirtyRelated = [];
 
+    /**
+     * Related records loaded eagerly, by lowercase alias
+     *
+     * @var array
+     */
+    protected eagerRelated = [];
+
     /**
      * @var array
      */
     protected errorMessages = [];
 
+    /**
+     * Set by markAsNew(), save() inserts without checking if the record exists
+     *
+     * @var bool
+     */
+    protected markedAsNew = false;
+
     /**
      * @var ManagerInterface|null
      */
@@ -437,6 +452,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 }
 
                 unset this->related[lowerProperty];
+                unset this->eagerRelated[lowerProperty];
 
                 let this->dirtyRelated[lowerProperty] = value,
                     this->dirtyState                  = dirtyState;
@@ -472,6 +488,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                             referencedModel->assign(value);
 
                             unset this->related[lowerProperty];
+                            unset this->eagerRelated[lowerProperty];
 
                             let this->dirtyRelated[lowerProperty] = referencedModel,
                                 this->dirtyState = self::DIRTY_STATE_TRANSIENT;
@@ -494,6 +511,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                         }
 
                         unset this->related[lowerProperty];
+                        unset this->eagerRelated[lowerProperty];
 
                         if count(related) > 0 {
                             let this->dirtyRelated[lowerProperty] = related,
@@ -1240,7 +1258,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          * Get the current connection use write to prevent replica lag
          * If the record already exists we must throw an exception
          */
-        if this->has(metaData, this->getWriteConnection()) {
+        if !this->markedAsNew && this->has(metaData, this->getWriteConnection()) {
             let this->errorMessages = [
                 new Message(
                     "Record cannot be created because it already exists",
@@ -1428,8 +1446,10 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          * we can get proper counts.
          */
         if (success) {
-            let this->related = [];
+            let this->related      = [],
+                this->eagerRelated = [];
             this->modelsManager->clearReusableObjects();
+            this->updateManagerState(true);
         }
 
         /**
@@ -1629,7 +1649,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      *         'lifetime' => 3600,
      *         'key' => 'my-find-key'
      *     ],
-     *     'hydration' => null
+     *     'hydration' => null,
+     *     'with' => ['parts', 'parts.type']
      * ]
      * @return T[]|\Phalcon\Mvc\Model\Resultset<int, T>
      */
@@ -1747,14 +1768,30 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      *         'lifetime' => 3600,
      *         'key' => 'my-find-key'
      *     ],
-     *     'hydration' => null
+     *     'hydration' => null,
+     *     'with' => ['parts', 'parts.type']
      * ]
      *
      * @return T|\Phalcon\Mvc\ModelInterface|\Phalcon\Mvc\Model\Row|null
      */
     public static function findFirst(var parameters = null) -> var | null
     {
-        var params, query;
+        var manager, params, query, record;
+
+        /**
+         * A record loaded by its primary key could be in the identity map
+         */
+        if (typeof parameters === "int" || typeof parameters === "string") && is_numeric(parameters) {
+            let manager = Di::getDefault()->getShared("modelsManager");
+
+            if manager instanceof Manager {
+                let record = manager->getIdentity(get_called_class(), parameters);
+
+                if record !== null {
+                    return record;
+                }
+            }
+        }
 
         if null === parameters {
             let params = [];
@@ -2086,6 +2123,15 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             );
         }
 
+        /**
+         * Records loaded eagerly are returned without querying again
+         */
+        if arguments === null && fetch result, this->eagerRelated[lowerAlias] {
+            let this->related[lowerAlias] = result;
+
+            return result;
+        }
+
         /**
          * If there are any arguments, Manager with handle the caching of the records
          */
@@ -2153,7 +2199,11 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     public function isRelationshipLoaded(string relationshipAlias) -> bool
     {
-        return isset this->related[strtolower(relationshipAlias)];
+        var lowerAlias;
+
+        let lowerAlias = strtolower(relationshipAlias);
+
+        return isset this->related[lowerAlias] || isset this->eagerRelated[lowerAlias];
     }
 
     /**
@@ -2361,6 +2411,50 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return this->toArray();
     }
 
+    /**
+     * Declares the record as new. The next save() inserts it without
+     * checking first if it exists in the database
+     *
+     *```php
+     * $robot = new Robots();
+     *
+     * $robot->assign($data);
+     *
+     * $robot->markAsNew()->save(); // INSERT only
+     *```
+     */
+    public function markAsNew() -> <ModelInterface>
+    {
+        let this->dirtyState  = self::DIRTY_STATE_TRANSIENT,
+            this->markedAsNew = true;
+
+        return this;
+    }
+
+    /**
+     * Declares the record as existing in the database. The next save()
+     * updates it by its primary key without checking first if it exists
+     *
+     *```php
+     * $robot = new Robots();
+     *
+     * $robot->assign($data);
+     *
+     * $robot->markAsPersistent()->save(); // UPDATE only
+     *```
+     */
+    public function markAsPersistent() -> <ModelInterface>
+    {
+        /**
+         * The primary key condition is rebuilt from the current values
+         */
+        let this->dirtyState  = self::DIRTY_STATE_PERSISTENT,
+            this->markedAsNew = false,
+            this->uniqueKey   = null;
+
+        return this;
+    }
+
     /**
      * Returns the maximum value of a column for a result-set of rows that match
      * the specified conditions
@@ -2671,9 +2765,14 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         let readConnection = this->getReadConnection();
 
         /**
-         * We need to check if the record exists
+         * We need to check if the record exists, unless it has been marked as
+         * new
          */
-        let exists = this->has(metaData, readConnection);
+        if this->markedAsNew {
+            let exists = false;
+        } else {
+            let exists = this->has(metaData, readConnection);
+        }
 
         if exists {
             let this->operationMade = self::OP_UPDATE;
@@ -2737,7 +2836,10 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          * Change the dirty state to persistent
          */
         if true === success {
-            let this->dirtyState = self::DIRTY_STATE_PERSISTENT;
+            let this->dirtyState  = self::DIRTY_STATE_PERSISTENT,
+                this->markedAsNew = false;
+
+            this->updateManagerState();
         }
 
         if hasRelatedToSave {
@@ -2770,9 +2872,11 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         } else {
             if hasRelatedToSave {
                 /**
-                 * Clear unsaved related records storage
+                 * Clear unsaved related records storage and the eagerly
+                 * loaded records, which may be stale now
                  */
-                let this->dirtyRelated = [];
+                let this->dirtyRelated = [],
+                    this->eagerRelated = [];
             }
 
             this->fireEvent("afterSave");
@@ -2907,6 +3011,27 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         );
     }
 
+    /**
+     * Attaches records loaded eagerly for a relation. `getRelated()` and the
+     * magic property return them instead of querying the database, until
+     * the relation is assigned or the record is saved or deleted.
+     *
+     * Relations returning many records are attached as resultsets, as when
+     * they are loaded lazily. `Phalcon\Mvc\Model\Manager::attachEagerRelations()`
+     * gives every record its own clone of a `Phalcon\Mvc\Model\Resultset\Simple`
+     *
+     * @param string                                 $alias
+     * @param ModelInterface|ResultsetInterface|null $records
+     *
+     * @return ModelInterface
+     */
+    public function setEagerRelated(string alias, var records) -> <ModelInterface>
+    {
+        let this->eagerRelated[strtolower(alias)] = records;
+
+        return this;
+    }
+
     /**
      * Sets the dirty state of the object using one of the DIRTY_STATE_* constants
      */
@@ -3401,6 +3526,189 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return this->save();
     }
 
+    /**
+     * Inserts the record, or updates it if a record with the same primary key
+     * already exists, in a single statement and without checking first if it
+     * exists. MySQL uses `INSERT ... ON DUPLICATE KEY UPDATE`, PostgreSQL and
+     * SQLite use `INSERT ... ON CONFLICT DO UPDATE`.
+     *
+     * The record is validated and the create events are fired. Attributes
+     * that are null and have a default value are left out.
+     *
+     *```php
+     * $robot = new Robots();
+     *
+     * $robot->id   = 100;
+     * $robot->name = "Astro Boy";
+     *
+     * $robot->upsert();
+     *```
+     */
+    public function upsert() -> bool
+    {
+        var attributeField, attributes, automaticAttributes, bindDataTypes,
+            bindType, bindTypes, columnMap, conflictFields, defaultValues,
+            field, fields, identityField, lastInsertedId, manager, metaData,
+            schema, snapshot, source, success, table, value, values,
+            writeConnection;
+        bool identityGenerated;
+
+        let metaData        = this->getModelsMetaData(),
+            manager         = <ManagerInterface> this->modelsManager,
+            writeConnection = this->getWriteConnection();
+
+        if unlikely !method_exists(writeConnection, "upsert") {
+            throw new Exception(
+                "The connection of '" . get_class(this) . "' does not support upserts"
+            );
+        }
+
+        let conflictFields = metaData->getPrimaryKeyAttributes(this);
+
+        if unlikely !count(conflictFields) {
+            throw new Exception(
+                "A primary key must be defined in the model '" . get_class(this) . "' in order to perform an upsert"
+            );
+        }
+
+        this->fireEvent("prepareSave");
+
+        let this->operationMade = self::OP_CREATE,
+            this->errorMessages = [],
+            identityField       = metaData->getIdentityField(this);
+
+        /**
+         * preSave() makes all the validations
+         */
+        if this->preSave(metaData, false, identityField) === false {
+            if unlikely globals_get("orm.exception_on_failed_save") {
+                throw new ValidationFailed(
+                    this,
+                    this->getMessages()
+                );
+            }
+
+            return false;
+        }
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(this);
+        } else {
+            let columnMap = null;
+        }
+
+        let fields              = [],
+            values              = [],
+            bindTypes           = [],
+            snapshot            = [],
+            identityGenerated   = false,
+            attributes          = metaData->getAttributes(this),
+            bindDataTypes       = metaData->getBindTypes(this),
+            automaticAttributes = metaData->getAutomaticCreateAttributes(this),
+            defaultValues       = metaData->getDefaultValues(this);
+
+        for field in attributes {
+            if typeof columnMap === "array" {
+                if unlikely !fetch attributeField, columnMap[field] {
+                    throw new Exception(
+                        "Column '" . field . "' in '" . get_class(this) . "' isn't part of the column map"
+                    );
+                }
+            } else {
+                let attributeField = field;
+            }
+
+            if isset automaticAttributes[attributeField] {
+                continue;
+            }
+
+            if !fetch value, this->{attributeField} {
+                let value = null;
+            }
+
+            /**
+             * An empty identity is generated by the database
+             */
+            if field == identityField && (value === null || value === "") {
+                let identityGenerated = true;
+
+                continue;
+            }
+
+            if value === null && isset defaultValues[field] {
+                continue;
+            }
+
+            if unlikely !fetch bindType, bindDataTypes[field] {
+                throw new Exception(
+                    "Column '" . field . "' in '" . get_class(this) . "' have not defined a bind data type"
+                );
+            }
+
+            let fields[]                 = field,
+                values[]                 = value,
+                bindTypes[]              = bindType,
+                snapshot[attributeField] = value;
+        }
+
+        let schema = this->getSchema(),
+            source = this->getSource();
+
+        if schema {
+            let table = schema . "." . source;
+        } else {
+            let table = source;
+        }
+
+        let success = writeConnection->{"upsert"}(
+            table,
+            values,
+            fields,
+            conflictFields,
+            bindTypes
+        );
+
+        if success {
+            if identityGenerated {
+                let lastInsertedId = this->getLastInsertedId(writeConnection, identityField);
+
+                if typeof columnMap === "array" {
+                    let attributeField = columnMap[identityField];
+                } else {
+                    let attributeField = identityField;
+                }
+
+                let this->{attributeField}   = lastInsertedId,
+                    snapshot[attributeField] = lastInsertedId;
+            }
+
+            /**
+             * The primary key condition is rebuilt on the next update
+             */
+            let this->dirtyState  = self::DIRTY_STATE_PERSISTENT,
+                this->markedAsNew = false,
+                this->uniqueKey   = null;
+
+            this->updateManagerState();
+
+            if manager->isKeepingSnapshots(this) && globals_get("orm.update_snapshot_on_save") {
+                let this->snapshot = array_merge(this->snapshot, snapshot);
+            }
+        }
+
+        if globals_get("orm.events") {
+            let success = this->postSave(success, false);
+        }
+
+        if success === false {
+            this->cancelOperation();
+        } else {
+            this->fireEvent("afterSave");
+        }
+
+        return success;
+    }
+
     /**
      * Writes an attribute value by its name
      *
@@ -3413,6 +3721,35 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         let this->{attribute} = value;
     }
 
+    /**
+     * Changes the version of the table of the model and registers the record
+     * in the identity map, or removes it once deleted, if the models manager
+     * keeps them
+     */
+    protected function updateManagerState(bool deleted = false) -> void
+    {
+        var manager;
+
+        let manager = this->modelsManager;
+
+        if !(manager instanceof Manager) {
+            return;
+        }
+
+        manager->bumpTableVersions(
+            [
+                [this->getSource(), this->getSchema()]
+            ],
+            this->getWriteConnection()
+        );
+
+        if deleted {
+            manager->removeIdentity(this);
+        } else {
+            manager->addIdentity(this, true);
+        }
+    }
+
     /**
      * Reads "belongs to" relations and check the virtual foreign keys when
      * inserting or updating records to verify that inserted/updated values are
@@ -3761,8 +4098,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     {
         var attributeField, attributes, automaticAttributes, bindDataTypes,
             bindSkip, bindType, bindTypes, columnMap, defaultValue, defaultValues,
-            field, fields, lastInsertedId, manager, sequenceName, schema,
-            snapshot, source, success, unsetDefaultValues, value, values;
+            field, fields, lastInsertedId, manager, snapshot, success,
+            unsetDefaultValues, value, values;
         bool useExplicitIdentity;
 
         let bindSkip            = Column::BIND_SKIP,
@@ -3936,37 +4273,10 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         let success = connection->insert(table, values, fields, bindTypes);
 
         if success && identityField !== false {
-            /**
-             * We check if the model have sequences
-             */
-            let sequenceName = null;
-
-            if connection->supportSequences() {
-                if method_exists(this, "getSequenceName") {
-                    let sequenceName = this->{"getSequenceName"}();
-                } else {
-                    let source = this->getSource(),
-                        schema = this->getSchema();
-
-                    if empty schema {
-                        let sequenceName = source . "_" . identityField . "_seq";
-                    } else {
-                        let sequenceName = schema . "." . source . "_" . identityField . "_seq";
-                    }
-                }
-            }
-
             /**
              * Recover the last "insert id" and assign it to the object
              */
-            let lastInsertedId = connection->lastInsertId(sequenceName);
-
-            /**
-             * If we want auto casting
-             */
-            if unlikely globals_get("orm.cast_last_insert_id_to_int") {
-                let lastInsertedId = intval(lastInsertedId, 10);
-            }
+            let lastInsertedId = this->getLastInsertedId(connection, identityField);
 
             let this->{attributeField}   = lastInsertedId,
                 snapshot[attributeField] = lastInsertedId;
@@ -4448,6 +4758,45 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return false;
     }
 
+    /**
+     * Returns the value generated for the identity column by the last insert
+     */
+    protected function getLastInsertedId(<AdapterInterface> connection, string identityField)
+    {
+        var lastInsertedId, schema, sequenceName, source;
+
+        /**
+         * We check if the model have sequences
+         */
+        let sequenceName = null;
+
+        if connection->supportSequences() {
+            if method_exists(this, "getSequenceName") {
+                let sequenceName = this->{"getSequenceName"}();
+            } else {
+                let source = this->getSource(),
+                    schema = this->getSchema();
+
+                if empty schema {
+                    let sequenceName = source . "_" . identityField . "_seq";
+                } else {
+                    let sequenceName = schema . "." . source . "_" . identityField . "_seq";
+                }
+            }
+        }
+
+        let lastInsertedId = connection->lastInsertId(sequenceName);
+
+        /**
+         * If we want auto casting
+         */
+        if unlikely globals_get("orm.cast_last_insert_id_to_int") {
+            let lastInsertedId = intval(lastInsertedId, 10);
+        }
+
+        return lastInsertedId;
+    }
+
     /**
      * Returns related records defined relations depending on the method name.
      * Returns false if the relation is non-existent.
@@ -5339,6 +5688,12 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          */
         connection->commit(nesting);
 
+        let manager = this->modelsManager;
+
+        if manager instanceof Manager {
+            manager->flushTableVersions();
+        }
+
         return true;
     }
 
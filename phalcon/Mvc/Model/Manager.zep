@@ -10,15 +10,18 @@
 
 namespace Phalcon\Mvc\Model;
 
+use Phalcon\Cache\CacheInterface;
 use Phalcon\Db\Adapter\AdapterInterface;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface as EventsManagerInterface;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Mvc\Model\Query\Builder;
 use Phalcon\Mvc\Model\Query\BuilderInterface;
 use Phalcon\Mvc\Model\Query\StatusInterface;
+use Phalcon\Mvc\Model\Resultset\Simple;
 use ReflectionClass;
 use ReflectionProperty;
 
@@ -47,7 +50,7 @@ use ReflectionProperty;
  * $robot = new Robots($di);
  * ```
  */
-class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareInterface
+class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareInterface, ResettableInterface
 {
     /**
      * @var array
@@ -158,6 +161,28 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     protected hasOneThroughSingle = [];
 
+    /**
+     * Attributes of the primary key by model
+     *
+     * @var array
+     */
+    protected identityFields = [];
+
+    /**
+     * Key of every record in the identity map, by object id, so that the
+     * entry can be moved when the primary key changes
+     *
+     * @var array
+     */
+    protected identityKeys = [];
+
+    /**
+     * Loaded records by model and primary key, null when disabled
+     *
+     * @var array|null
+     */
+    protected identityMap = null;
+
     /**
      * Mark initialized models
      *
@@ -209,6 +234,20 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     protected schemas = [];
 
+    /**
+     * Tables changed within a transaction, keyed by connection
+     *
+     * @var array
+     */
+    protected pendingTableVersions = [];
+
+    /**
+     * Cache service holding the table versions, null when disabled
+     *
+     * @var string|null
+     */
+    protected tableVersionsService = null;
+
     /**
      * @var array
      */
@@ -803,6 +842,175 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return relation;
     }
 
+    /**
+     * Registers a record in the identity map. Returns the record already
+     * registered with the same primary key unless `replace` is set, in which
+     * case it is replaced. A record registered before under another primary
+     * key is removed from it
+     *
+     * @param ModelInterface $record
+     * @param bool           $replace
+     *
+     * @return ModelInterface
+     */
+    public function addIdentity(<ModelInterface> record, bool replace = false) -> <ModelInterface>
+    {
+        var entityName, existing, id, key, previous;
+
+        if this->identityMap === null {
+            return record;
+        }
+
+        let key = this->getIdentityKey(record);
+
+        if key === null {
+            return record;
+        }
+
+        let entityName = get_class_lower(record);
+
+        if !replace && fetch existing, this->identityMap[entityName][key] {
+            return existing;
+        }
+
+        let id = spl_object_id(record);
+
+        /**
+         * The primary key of the record has been changed by a save
+         */
+        if fetch previous, this->identityKeys[id] && previous !== key {
+            if fetch existing, this->identityMap[entityName][previous] && existing === record {
+                unset this->identityMap[entityName][previous];
+            }
+        }
+
+        if fetch existing, this->identityMap[entityName][key] && existing !== record {
+            unset this->identityKeys[spl_object_id(existing)];
+        }
+
+        let this->identityMap[entityName][key] = record,
+            this->identityKeys[id]             = key;
+
+        return record;
+    }
+
+    /**
+     * Attaches the records loaded by getEagerRelations() to a record. The
+     * records of to-many relations are resultsets, as when they are loaded
+     * lazily
+     *
+     * @param ModelInterface $record
+     * @param array          $eagerRelations
+     *
+     * @return void
+     */
+    public function attachEagerRelations(<ModelInterface> record, array eagerRelations) -> void
+    {
+        var alias, data, key, records, related;
+
+        if !method_exists(record, "setEagerRelated") {
+            return;
+        }
+
+        for alias, data in eagerRelations {
+            let key     = this->getEagerKey(data["fields"], record),
+                records = data["records"];
+
+            if null === key || !fetch related, records[key] {
+                let related = data["empty"];
+            }
+
+            /**
+             * Every record iterates its own resultset
+             */
+            if !data["single"] {
+                let related = clone related;
+            }
+
+            record->{"setEagerRelated"}(alias, related);
+        }
+    }
+
+    /**
+     * Changes the version of the tables, so that the results cached with an
+     * automatic key by the queries reading from them are no longer used
+     *
+     * When `connection` is under a transaction, the versions are changed
+     * again once it is committed or rolled back, since the results read in
+     * between may be cached with the new versions.
+     *
+     * @param array                 $tables     Table names, or `[source, schema]` pairs
+     * @param AdapterInterface|null $connection Connection that wrote the tables
+     *
+     * @return void
+     */
+    public function bumpTableVersions(
+        array tables,
+        <AdapterInterface> connection = null
+    ) -> void {
+        var id, key, pending, table;
+        array versions;
+
+        if this->tableVersionsService === null {
+            return;
+        }
+
+        this->flushTableVersions();
+
+        let versions = [];
+
+        for table in tables {
+            let versions[this->getTableVersionKey(table)] = uniqid("", true);
+        }
+
+        if connection !== null && connection->isUnderTransaction() {
+            let id = spl_object_id(connection);
+
+            if !fetch pending, this->pendingTableVersions[id] {
+                let pending = [
+                    "connection" : connection,
+                    "keys"       : []
+                ];
+            }
+
+            for key in array_keys(versions) {
+                let pending["keys"][key] = true;
+            }
+
+            let this->pendingTableVersions[id] = pending;
+        }
+
+        this->getTableVersionsCache()->setMultiple(versions);
+    }
+
+    /**
+     * Removes all the records from the identity map, for instance at the end
+     * of a unit of work, or only the records of `modelName`
+     */
+    public function clearIdentityMap(string modelName = null) -> void
+    {
+        var record, records;
+
+        if this->identityMap === null {
+            return;
+        }
+
+        if modelName === null {
+            let this->identityMap  = [],
+                this->identityKeys = [];
+
+            return;
+        }
+
+        if fetch records, this->identityMap[strtolower(modelName)] {
+            for record in records {
+                unset this->identityKeys[spl_object_id(record)];
+            }
+
+            unset this->identityMap[strtolower(modelName)];
+        }
+    }
+
     /**
      * Clears the internal reusable list
      */
@@ -968,6 +1176,47 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return this->hasHasOneThrough(modelName, modelRelation);
     }
 
+    /**
+     * Changes again the version of the tables written within transactions
+     * that have been committed or rolled back since
+     *
+     * @return void
+     */
+    public function flushTableVersions() -> void
+    {
+        var connection, id, key, pending;
+        array flushed, versions;
+
+        if this->tableVersionsService === null || empty this->pendingTableVersions {
+            return;
+        }
+
+        let flushed  = [],
+            versions = [];
+
+        for id, pending in this->pendingTableVersions {
+            let connection = pending["connection"];
+
+            if connection->isUnderTransaction() {
+                continue;
+            }
+
+            for key in array_keys(pending["keys"]) {
+                let versions[key] = uniqid("", true);
+            }
+
+            let flushed[] = id;
+        }
+
+        for id in flushed {
+            unset this->pendingTableVersions[id];
+        }
+
+        if count(versions) {
+            this->getTableVersionsCache()->setMultiple(versions);
+        }
+    }
+
     /**
      * Gets all the belongsTo relations defined in a model
      *
@@ -1093,6 +1342,83 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return this->container;
     }
 
+    /**
+     * Loads relations for a list of records with one query per relation, two
+     * for relations through an intermediate model. Nested relations are
+     * separated by dots and are attached to the related records. The
+     * returned array is passed to attachEagerRelations() for each record.
+     *
+     * Relations with a `limit` in their parameters cannot be loaded in one
+     * query and are left to be loaded lazily
+     *
+     *```php
+     * $eager = $manager->getEagerRelations(
+     *     Robots::class,
+     *     $robots->toArray(),
+     *     ["parts", "parts.type"]
+     * );
+     *```
+     *
+     * @param string $modelName
+     * @param array  $records   Models or arrays of attributes
+     * @param array  $relations
+     *
+     * @return array
+     * @throws Exception
+     */
+    public function getEagerRelations(string! modelName, array records, array relations) -> array
+    {
+        var alias, grouped, loaded, nestedRelations, parts, path, relation,
+            rest;
+        array result;
+
+        let grouped = [],
+            result  = [];
+
+        for path in relations {
+            let parts = explode(".", path, 2),
+                alias = strtolower(parts[0]);
+
+            if !isset grouped[alias] {
+                let grouped[alias] = [];
+            }
+
+            if fetch rest, parts[1] {
+                let grouped[alias][] = rest;
+            }
+        }
+
+        for alias, nestedRelations in grouped {
+            let relation = this->getRelationByAlias(modelName, alias);
+
+            if unlikely typeof relation !== "object" {
+                throw new Exception(
+                    "There is no defined relations for the model '"
+                    . modelName . "' using alias '" . alias . "'"
+                );
+            }
+
+            let loaded = this->getEagerRelationRecords(
+                relation,
+                records,
+                nestedRelations
+            );
+
+            if null === loaded {
+                continue;
+            }
+
+            let result[alias] = [
+                "empty"   : loaded["empty"],
+                "fields"  : relation->getFields(),
+                "records" : loaded["records"],
+                "single"  : loaded["single"]
+            ];
+        }
+
+        return result;
+    }
+
     /**
      * Returns the internal event manager
      */
@@ -1228,6 +1554,30 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return relations;
     }
 
+    /**
+     * Returns the record of the identity map with the primary key `key`, a
+     * value or the list of values of a compound key, or null
+     *
+     * @param string $modelName
+     * @param mixed  $key
+     *
+     * @return ModelInterface|null
+     */
+    public function getIdentity(string! modelName, var key) -> <ModelInterface> | null
+    {
+        var record;
+
+        if this->identityMap === null || key === null {
+            return null;
+        }
+
+        if !fetch record, this->identityMap[strtolower(modelName)][this->getIdentityValue(key)] {
+            return null;
+        }
+
+        return record;
+    }
+
     /**
      * Get last initialized model
      */
@@ -1236,6 +1586,64 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return this->lastInitialized;
     }
 
+    /**
+     * Returns the current version of each table, keyed by table. Missing
+     * versions are created
+     *
+     * @param array $tables Table names, or `[source, schema]` pairs
+     *
+     * @return array
+     * @throws Exception
+     */
+    public function getTableVersions(array tables) -> array
+    {
+        var cache, key, table, value;
+        array keys, missing, versions;
+
+        if unlikely this->tableVersionsService === null {
+            throw new Exception(
+                "The table versions service has not been set"
+            );
+        }
+
+        this->flushTableVersions();
+
+        let keys = [];
+
+        for table in tables {
+            let keys[] = this->getTableVersionKey(table);
+        }
+
+        let cache    = this->getTableVersionsCache(),
+            versions = [],
+            missing  = [];
+
+        for key, value in cache->getMultiple(array_unique(keys)) {
+            if value === null {
+                let value        = uniqid("", true),
+                    missing[key] = value;
+            }
+
+            let versions[key] = value;
+        }
+
+        if count(missing) {
+            cache->setMultiple(missing);
+        }
+
+        ksort(versions);
+
+        return versions;
+    }
+
+    /**
+     * Returns the cache service holding the table versions
+     */
+    public function getTableVersionsService() -> string | null
+    {
+        return this->tableVersionsService;
+    }
+
     /**
      * Returns the last query created or executed in the models manager
      */
@@ -1462,6 +1870,28 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         if typeof fields != "array" {
             let conditions[] = "[" . referencedModel . "].[". referencedFields . "] = :APR0:",
                 placeholders["APR0"] = record->readAttribute(fields);
+
+            /**
+             * The parent of a belongs-to relation on its primary key could be
+             * in the identity map
+             */
+            if (
+                this->identityMap !== null &&
+                method === null &&
+                parameters === null &&
+                empty extraParameters &&
+                relation->getType() == Relation::BELONGS_TO &&
+                this->getIdentityFields(this->load(referencedModel)) === [referencedFields]
+            ) {
+                let records = this->getIdentity(
+                    referencedModel,
+                    placeholders["APR0"]
+                );
+
+                if records !== null {
+                    return records;
+                }
+            }
         } else {
             for refPosition, field in relation->getFields() {
                 let conditions[] = "[" . referencedModel . "].[". referencedFields[refPosition] . "] = :APR" . refPosition . ":",
@@ -1839,6 +2269,94 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return isset this->initialized[strtolower(className)];
     }
 
+    /**
+     * Checks if the records of a model can be updated, or deleted, with a
+     * single statement instead of one by one: the model has no event methods,
+     * listeners, behaviors or virtual foreign keys that the write of every
+     * record would trigger and, when updating, no not null validations or
+     * attributes skipped on update
+     *
+     * @param ModelInterface $model
+     * @param bool           $deleting
+     *
+     * @return bool
+     */
+    public function isBulkWritable(<ModelInterface> model, bool deleting = false) -> bool
+    {
+        var attribute, entityName, eventName, events, metaData, primaryKeys,
+            relation;
+
+        let entityName = get_class_lower(model);
+
+        if globals_get("orm.events") {
+            if (
+                this->eventsManager !== null ||
+                isset this->customEventsManager[entityName] ||
+                isset this->behaviors[entityName]
+            ) {
+                return false;
+            }
+
+            if deleting {
+                let events = [
+                    "beforeDelete",
+                    "afterDelete"
+                ];
+            } else {
+                let events = [
+                    "beforeValidation",
+                    "beforeValidationOnUpdate",
+                    "validation",
+                    "onValidationFails",
+                    "afterValidationOnUpdate",
+                    "afterValidation",
+                    "beforeSave",
+                    "beforeUpdate",
+                    "afterUpdate",
+                    "afterSave",
+                    "notSaved",
+                    "prepareSave"
+                ];
+            }
+
+            for eventName in events {
+                if method_exists(model, eventName) {
+                    return false;
+                }
+            }
+        }
+
+        if globals_get("orm.virtual_foreign_keys") {
+            for relation in this->getRelations(get_class(model)) {
+                if relation->getForeignKey() !== false {
+                    return false;
+                }
+            }
+        }
+
+        if deleting {
+            return true;
+        }
+
+        let metaData = model->getModelsMetaData();
+
+        if count(metaData->getAutomaticUpdateAttributes(model)) {
+            return false;
+        }
+
+        if globals_get("orm.not_null_validations") {
+            let primaryKeys = metaData->getPrimaryKeyAttributes(model);
+
+            for attribute in metaData->getNotNullAttributes(model) {
+                if !in_array(attribute, primaryKeys) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
     /**
      * Checks if a model is keeping snapshots for the queried records
      *
@@ -1884,7 +2402,17 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
     }
 
     /**
-     * Check whether a model property is declared as public.
+     * Checks if the loaded records are kept in the identity map
+     *
+     * @return bool
+     */
+    public function isUsingIdentityMap() -> bool
+    {
+        return this->identityMap !== null;
+    }
+
+    /**
+     * Check whether a model property is declared as public.
      *
      * ```php
      * $isPublic = $manager->isVisibleModelProperty(
@@ -2077,6 +2605,54 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return null;
     }
 
+    /**
+     * Removes a record from the identity map
+     *
+     * @param ModelInterface $record
+     *
+     * @return void
+     */
+    public function removeIdentity(<ModelInterface> record) -> void
+    {
+        var existing, id, key, entityName;
+
+        if this->identityMap === null {
+            return;
+        }
+
+        let id         = spl_object_id(record),
+            entityName = get_class_lower(record);
+
+        /**
+         * The record is registered under the primary key it was saved with
+         */
+        if fetch key, this->identityKeys[id] {
+            if fetch existing, this->identityMap[entityName][key] && existing === record {
+                unset this->identityMap[entityName][key];
+            }
+
+            unset this->identityKeys[id];
+        }
+
+        let key = this->getIdentityKey(record);
+
+        if key !== null {
+            unset this->identityMap[entityName][key];
+        }
+    }
+
+    /**
+     * Removes the records kept for the last request: the identity map and the
+     * reusable records. The tables written within the transactions ended
+     * since are versioned again
+     */
+    public function resetRequest() -> void
+    {
+        this->clearIdentityMap();
+        this->clearReusableObjects();
+        this->flushTableVersions();
+    }
+
     /**
      * Sets both write and read connection service for a model
      *
@@ -2212,6 +2788,32 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         let this->reusable[key] = records;
     }
 
+    /**
+     * Enables the table versions, stored in the `service` cache. Queries
+     * cached without a key are then keyed by their PHQL, their bind
+     * parameters and the versions of their tables, which change on every
+     * write through the ORM. `null` disables them
+     *
+     *```php
+     * $modelsManager->setTableVersionsService("modelsCache");
+     *
+     * $robots = Robots::find(
+     *     [
+     *         "type = 'mechanical'",
+     *         "cache" => [
+     *             "lifetime" => 3600,
+     *         ],
+     *     ]
+     * );
+     *```
+     */
+    public function setTableVersionsService(string service = null) -> <Manager>
+    {
+        let this->tableVersionsService = service;
+
+        return this;
+    }
+
     /**
      * Sets write connection service for a model
      *
@@ -2242,6 +2844,37 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
             this->keepSnapshots[entityName] = dynamicUpdate;
     }
 
+    /**
+     * Keeps the loaded records in an identity map, keyed by model and primary
+     * key. `findFirst()` by primary key and the belongs-to relations return
+     * the registered record without querying, and the records hydrated again
+     * are replaced by the registered ones. Saved records are registered and
+     * deleted ones removed. Disabling the map empties it
+     *
+     *```php
+     * $modelsManager->useIdentityMap();
+     *
+     * $robot = Robots::findFirst(1);
+     *
+     * var_dump($robot === Robots::findFirst(1)); // true
+     *```
+     *
+     * @param bool $useIdentityMap
+     *
+     * @return Manager
+     */
+    public function useIdentityMap(bool useIdentityMap = true) -> <Manager>
+    {
+        if !useIdentityMap {
+            let this->identityMap  = null,
+                this->identityKeys = [];
+        } elseif this->identityMap === null {
+            let this->identityMap = [];
+        }
+
+        return this;
+    }
+
     /**
      * Returns the connection to read or write data related to a model
      * depending on the connection services.
@@ -2279,6 +2912,512 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return connection;
     }
 
+    /**
+     * Returns the cache holding the table versions
+     */
+    protected function getTableVersionsCache() -> <CacheInterface>
+    {
+        var cache, container;
+
+        let container = <DiInterface> this->container;
+
+        if unlikely typeof container != "object" {
+            throw new Exception(
+                "A dependency injection container is required to access the services related to the ORM"
+            );
+        }
+
+        let cache = container->getShared(this->tableVersionsService);
+
+        if unlikely !(cache instanceof CacheInterface) {
+            throw new Exception(
+                "Cache service must be an object implementing " .
+                "Phalcon\\Cache\\CacheInterface"
+            );
+        }
+
+        return cache;
+    }
+
+    /**
+     * Returns the cache key of the version of a table
+     *
+     * @param array|string $table
+     *
+     * @return string
+     */
+    protected function getTableVersionKey(var table) -> string
+    {
+        if typeof table === "array" {
+            if isset table[1] && !empty table[1] {
+                let table = table[1] . "." . table[0];
+            } else {
+                let table = table[0];
+            }
+        }
+
+        return "phql-version-" . table;
+    }
+
+    /**
+     * Returns the attributes of the primary key of a model
+     *
+     * @param ModelInterface $model
+     *
+     * @return array
+     */
+    protected function getIdentityFields(<ModelInterface> model) -> array
+    {
+        var attribute, columnMap, entityName, field, fields, metaData;
+        array attributes;
+
+        let entityName = get_class_lower(model);
+
+        if fetch fields, this->identityFields[entityName] {
+            return fields;
+        }
+
+        let metaData   = model->getModelsMetaData(),
+            columnMap  = null,
+            attributes = [];
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(model);
+        }
+
+        for field in metaData->getPrimaryKeyAttributes(model) {
+            if typeof columnMap != "array" || !fetch attribute, columnMap[field] {
+                let attribute = field;
+            }
+
+            let attributes[] = attribute;
+        }
+
+        let this->identityFields[entityName] = attributes;
+
+        return attributes;
+    }
+
+    /**
+     * Returns the key of a record in the identity map, null if it has no
+     * primary key or any of its values is null
+     *
+     * @param ModelInterface $record
+     *
+     * @return string|null
+     */
+    protected function getIdentityKey(<ModelInterface> record) -> string | null
+    {
+        var field, fields, value;
+        array values;
+
+        let fields = this->getIdentityFields(record);
+
+        if !count(fields) {
+            return null;
+        }
+
+        let values = [];
+
+        for field in fields {
+            let value = record->readAttribute(field);
+
+            if value === null {
+                return null;
+            }
+
+            let values[] = value;
+        }
+
+        return this->getIdentityValue(values);
+    }
+
+    /**
+     * Returns the key of a primary key value, or values, in the identity map
+     *
+     * @param mixed $key
+     *
+     * @return string
+     */
+    protected function getIdentityValue(var key) -> string
+    {
+        if typeof key == "array" {
+            let key = array_values(key);
+
+            if count(key) == 1 {
+                return (string) key[0];
+            }
+
+            return json_encode(array_map("strval", key));
+        }
+
+        return (string) key;
+    }
+
+    /**
+     * Returns the columns selecting the fields of a model for eager loading,
+     * keyed by their aliases
+     *
+     * @param string       $modelName
+     * @param array|string $fields
+     * @param string       $prefix
+     *
+     * @return array
+     */
+    protected function getEagerColumns(string modelName, var fields, string prefix) -> array
+    {
+        var field, position;
+        array columns;
+
+        if typeof fields !== "array" {
+            let fields = [fields];
+        }
+
+        let columns = [];
+
+        for position, field in fields {
+            let columns[prefix . position] = "[" . modelName . "].[" . field . "] AS " . prefix . position;
+        }
+
+        return columns;
+    }
+
+    /**
+     * Returns the conditions and the bound parameters matching the fields of
+     * a model with the keys returned by getEagerKey()
+     *
+     * @param string       $modelName
+     * @param array|string $fields
+     * @param array        $keys
+     *
+     * @return array
+     */
+    protected function getEagerConditions(string modelName, var fields, array keys) -> array
+    {
+        var field, key, position, values;
+        array bind, conditions, parts;
+        int index;
+
+        if typeof fields === "array" && count(fields) === 1 {
+            let fields = reset(fields);
+        }
+
+        if typeof fields !== "array" {
+            return [
+                "[" . modelName . "].[" . fields . "] IN ({APR0:array})",
+                ["APR0" : array_keys(keys)]
+            ];
+        }
+
+        /**
+         * Compound keys
+         */
+        let parts = [],
+            bind  = [],
+            index = 0;
+
+        for key, values in keys {
+            let values     = json_decode(key),
+                conditions = [];
+
+            for position, field in fields {
+                let conditions[] = "[" . modelName . "].[" . field . "] = :APR" . index . "_" . position . ":",
+                    bind["APR" . index . "_" . position] = values[position];
+            }
+
+            let parts[] = "(" . join(" AND ", conditions) . ")",
+                index++;
+        }
+
+        return [
+            join(" OR ", parts),
+            bind
+        ];
+    }
+
+    /**
+     * Returns the key of a record for eager loading: the value of the
+     * field, or the JSON of the values of compound fields. Returns `null`
+     * if any of the values is `null`
+     *
+     * @param array|string         $fields
+     * @param array|ModelInterface $record
+     *
+     * @return string|null
+     */
+    protected function getEagerKey(var fields, var record) -> string | null
+    {
+        var field, value;
+        array values;
+
+        if typeof fields !== "array" {
+            let fields = [fields];
+        }
+
+        let values = [];
+
+        for field in fields {
+            if typeof record === "array" {
+                if !fetch value, record[field] {
+                    return null;
+                }
+            } else {
+                let value = record->readAttribute(field);
+            }
+
+            if null === value {
+                return null;
+            }
+
+            let values[] = (string) value;
+        }
+
+        if count(values) === 1 {
+            return values[0];
+        }
+
+        return json_encode(values);
+    }
+
+    /**
+     * Loads the related records of a list of records. Returns the records
+     * keyed by the parent key in `records`, a resultset for each key of a
+     * to-many relation, and the value of the records without related ones in
+     * `empty`. Returns `null` if the relation cannot be loaded in one query
+     *
+     * @param RelationInterface $relation
+     * @param array             $records
+     * @param array             $nestedRelations
+     *
+     * @return array|null
+     */
+    protected function getEagerRelationRecords(
+        <RelationInterface> relation,
+        array records,
+        array nestedRelations = []
+    ) -> array | null {
+        var child, condition, empty, extraParameters, fields, findParams,
+            intermediateModel, key, keyColumns, positions, record, reference,
+            referenceColumns, referencedFields, referencedModel, resultset,
+            row, rows;
+        array byReference, keys, map, models, references, slices;
+        bool single;
+        int position;
+
+        let extraParameters = relation->getParams();
+
+        if typeof extraParameters == "array" && isset extraParameters["limit"] {
+            return null;
+        }
+
+        switch relation->getType() {
+            case Relation::BELONGS_TO:
+            case Relation::HAS_ONE:
+            case Relation::HAS_ONE_THROUGH:
+                let single = true;
+                break;
+
+            default:
+                let single = false;
+                break;
+        }
+
+        let fields           = relation->getFields(),
+            referencedModel  = relation->getReferencedModel(),
+            referencedFields = relation->getReferencedFields(),
+            keys             = [],
+            map              = [];
+
+        /**
+         * Collect the distinct keys of the records
+         */
+        for record in records {
+            let key = this->getEagerKey(fields, record);
+
+            if null !== key {
+                let keys[key] = true;
+            }
+        }
+
+        if count(keys) === 0 {
+            return [
+                "empty"   : single ? null : new Simple(null, this->load(referencedModel), false),
+                "records" : map,
+                "single"  : single
+            ];
+        }
+
+        let references = [];
+
+        if relation->isThrough() {
+            let intermediateModel = relation->getIntermediateModel(),
+                keyColumns        = this->getEagerColumns(
+                    intermediateModel,
+                    relation->getIntermediateFields(),
+                    "eagerKey"
+                ),
+                referenceColumns  = this->getEagerColumns(
+                    intermediateModel,
+                    relation->getIntermediateReferencedFields(),
+                    "eagerReference"
+                ),
+                condition         = this->getEagerConditions(
+                    intermediateModel,
+                    relation->getIntermediateFields(),
+                    keys
+                );
+
+            /**
+             * Pairs of keys from the intermediate model
+             */
+            let rows = this->createBuilder()
+                ->columns(
+                    join(", ", array_merge(keyColumns, referenceColumns))
+                )
+                ->from(intermediateModel)
+                ->where(condition[0], condition[1])
+                ->getQuery()
+                ->execute()
+                ->toArray();
+
+            for row in rows {
+                let reference = this->getEagerKey(array_keys(referenceColumns), row);
+
+                if null !== reference {
+                    let references[reference] = true;
+                }
+            }
+
+            if count(references) === 0 {
+                return [
+                    "empty"   : single ? null : new Simple(null, this->load(referencedModel), false),
+                    "records" : map,
+                    "single"  : single
+                ];
+            }
+
+            let condition = this->getEagerConditions(
+                referencedModel,
+                referencedFields,
+                references
+            );
+        } else {
+            let condition = this->getEagerConditions(
+                referencedModel,
+                referencedFields,
+                keys
+            );
+        }
+
+        let findParams = [
+            condition[0],
+            "bind" : condition[1],
+            "di"   : this->container
+        ];
+
+        if typeof extraParameters == "array" {
+            let findParams = this->mergeFindParameters(
+                extraParameters,
+                findParams
+            );
+        }
+
+        let resultset = call_user_func_array(
+            [
+                this->load(referencedModel),
+                "find"
+            ],
+            [findParams]
+        );
+
+        /**
+         * Nested relations are attached to the related records as they are
+         * hydrated
+         */
+        if count(nestedRelations) > 0 {
+            resultset->with(nestedRelations);
+        }
+
+        /**
+         * The resultset of the records without related ones also keeps the
+         * fetched rows in memory, so that they are not fetched again by the
+         * resultsets of each key
+         */
+        let empty = single ? null : resultset->slice([]);
+
+        let byReference = [],
+            models      = [],
+            position    = 0;
+
+        for child in resultset {
+            let key = this->getEagerKey(referencedFields, child);
+
+            if null !== key {
+                if relation->isThrough() {
+                    let byReference[key] = position;
+
+                    if single {
+                        let models[position] = child;
+                    }
+                } elseif single {
+                    if !isset map[key] {
+                        let map[key] = child;
+                    }
+                } else {
+                    let map[key][] = position;
+                }
+            }
+
+            let position++;
+        }
+
+        /**
+         * Map the related records to the keys through the intermediate rows
+         */
+        if relation->isThrough() {
+            for row in rows {
+                let reference = this->getEagerKey(array_keys(referenceColumns), row),
+                    key       = this->getEagerKey(array_keys(keyColumns), row);
+
+                if null === reference || null === key || !fetch position, byReference[reference] {
+                    continue;
+                }
+
+                if single {
+                    if !isset map[key] {
+                        let map[key] = models[position];
+                    }
+                } else {
+                    let map[key][] = position;
+                }
+            }
+        }
+
+        if single {
+            return [
+                "empty"   : empty,
+                "records" : map,
+                "single"  : single
+            ];
+        }
+
+        /**
+         * The related records of each key are a resultset of the rows
+         * already fetched
+         */
+        let slices = [];
+
+        for key, positions in map {
+            let slices[key] = resultset->slice(positions);
+        }
+
+        return [
+            "empty"   : empty,
+            "records" : slices,
+            "single"  : single
+        ];
+    }
+
     /**
      * Merge two arrays of find parameters
      *
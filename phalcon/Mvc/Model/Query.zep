@@ -16,6 +16,7 @@ use Phalcon\Db\ResultInterface;
 use Phalcon\Db\Adapter\AdapterInterface;
 use Phalcon\Di\DiInterface;
 use Phalcon\Mvc\ModelInterface;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\Query\Status;
 use Phalcon\Mvc\Model\Resultset\Complex;
 use Phalcon\Mvc\Model\Query\StatusInterface;
@@ -93,6 +94,14 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     protected bindParams = [];
 
+    /**
+     * Whether UPDATE and DELETE statements are executed with a single SQL
+     * statement
+     *
+     * @var bool
+     */
+    protected bulk = false;
+
     /**
      * @var array
      */
@@ -113,6 +122,13 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     protected container = null;
 
+    /**
+     * Relations to load eagerly for the records of a SELECT
+     *
+     * @var array
+     */
+    protected eagerRelations = [];
+
     /**
      * @var bool
      */
@@ -267,7 +283,8 @@ class Query implements QueryInterface, InjectionAwareInterface
             mergedParams, mergedTypes, preparedResult, result, type, uniqueRow;
 
         let uniqueRow    = this->uniqueRow,
-            cacheOptions = this->cacheOptions;
+            cacheOptions = this->cacheOptions,
+            intermediate = null;
 
         if cacheOptions !== null {
             if unlikely typeof cacheOptions != "array" {
@@ -275,12 +292,16 @@ class Query implements QueryInterface, InjectionAwareInterface
             }
 
             /**
-             * The user must set a cache key
+             * Without a cache key, the key is built from the statement and
+             * the versions of its tables if they are enabled
              */
-            if unlikely !fetch key, cacheOptions["key"] {
-                throw new Exception(
-                    "A cache key must be provided to identify the cached resultset in the cache backend"
-                );
+            if !fetch key, cacheOptions["key"] {
+                let intermediate = this->parse(),
+                    key          = this->getAutomaticCacheKey(
+                        intermediate,
+                        bindParams,
+                        bindTypes
+                    );
             }
 
             /**
@@ -324,6 +345,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 
                 result->setIsFresh(false);
 
+                this->loadEagerRelations(result);
+
                 /**
                  * Check if only the first row must be returned
                  */
@@ -343,7 +366,9 @@ class Query implements QueryInterface, InjectionAwareInterface
          * The statement is parsed from its PHQL string or a previously
          * processed IR
          */
-        let intermediate = this->parse();
+        if intermediate === null {
+            let intermediate = this->parse();
+        }
 
         /**
          * Check for default bind parameters and merge them with the passed ones
@@ -421,6 +446,10 @@ class Query implements QueryInterface, InjectionAwareInterface
             cache->set(key, result, lifetime);
         }
 
+        if type == PHQL_T_SELECT {
+            this->loadEagerRelations(result);
+        }
+
         /**
          * Check if only the first row must be returned
          */
@@ -465,6 +494,15 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this->bindTypes;
     }
 
+    /**
+     * Returns whether UPDATE and DELETE statements are executed with a single
+     * SQL statement
+     */
+    public function getBulk() -> bool
+    {
+        return this->bulk;
+    }
+
     /**
      * Returns the dependency injection container
      */
@@ -473,6 +511,14 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this->container;
     }
 
+    /**
+     * Returns the relations loaded eagerly for the records of a SELECT
+     */
+    public function getEagerRelations() -> array
+    {
+        return this->eagerRelations;
+    }
+
     /**
      * Returns the intermediate representation of the PHQL statement
      */
@@ -680,6 +726,38 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Executes UPDATE and DELETE statements with a single SQL statement
+     * (`true`) or record by record (`false`, the default). Statements with a
+     * LIMIT are always executed record by record.
+     *
+     * A single statement skips what the write of every record does: events,
+     * behaviors, validations (not null ones included), virtual foreign keys
+     * and the attributes skipped on update, so use it when
+     * `Phalcon\Mvc\Model\Manager::isBulkWritable()` finds none of them.
+     * The records are not loaded and the status returns the number of
+     * affected rows reported by the database. MySQL only counts the rows an
+     * UPDATE changed, unless the connection sets `PDO::MYSQL_ATTR_FOUND_ROWS`,
+     * while record by record every matching record is counted
+     *
+     *```php
+     * $status = $modelsManager
+     *     ->createQuery("UPDATE Robots SET status = 1 WHERE year < 2000")
+     *     ->setBulk(
+     *         $modelsManager->isBulkWritable(new Robots())
+     *     )
+     *     ->execute();
+     *
+     * echo $status->getAffectedRows();
+     *```
+     */
+    public function setBulk(bool bulk) -> <Query>
+    {
+        let this->bulk = bulk;
+
+        return this;
+    }
+
     /**
      * Sets the dependency injection container
      */
@@ -705,6 +783,21 @@ class Query implements QueryInterface, InjectionAwareInterface
         let this->container = container;
     }
 
+    /**
+     * Sets the relations to load eagerly for the records of a SELECT, using
+     * dots for nested relations
+     *
+     *```php
+     * $query->setEagerRelations(["parts", "parts.type"]);
+     *```
+     */
+    public function setEagerRelations(array eagerRelations) -> <QueryInterface>
+    {
+        let this->eagerRelations = eagerRelations;
+
+        return this;
+    }
+
     /**
      * Allows to set the IR to be executed
      */
@@ -756,6 +849,178 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Returns the cache key of a SELECT from its PHQL (or IR), its bind
+     * parameters and the current versions of the tables it reads
+     */
+    protected function getAutomaticCacheKey(array intermediate, array bindParams, array bindTypes) -> string
+    {
+        var manager, mergedTypes;
+
+        let manager = this->manager;
+
+        if unlikely (
+            !(manager instanceof Manager) ||
+            manager->getTableVersionsService() === null
+        ) {
+            throw new Exception(
+                "A cache key must be provided to identify the cached resultset in the cache backend"
+            );
+        }
+
+        if unlikely this->type != PHQL_T_SELECT {
+            throw new Exception(
+                "Only PHQL statements that return resultsets can be cached"
+            );
+        }
+
+        if typeof this->bindTypes == "array" {
+            let mergedTypes = this->bindTypes + bindTypes;
+        } else {
+            let mergedTypes = bindTypes;
+        }
+
+        return "phql-" . sha1(
+            serialize(
+                [
+                    this->phql ? this->phql : intermediate,
+                    this->bindParams + bindParams,
+                    mergedTypes,
+                    manager->getTableVersions(
+                        this->getSourceTables(intermediate)
+                    )
+                ]
+            )
+        );
+    }
+
+    /**
+     * Returns the tables read by a SELECT intermediate representation
+     */
+    protected function getSourceTables(array intermediate) -> array
+    {
+        var join, joins, table, tables;
+        array sources;
+
+        let sources = [];
+
+        if fetch tables, intermediate["tables"] {
+            for table in tables {
+                let sources[] = table;
+            }
+        }
+
+        if fetch joins, intermediate["joins"] {
+            for join in joins {
+                let sources[] = join["source"];
+            }
+        }
+
+        return sources;
+    }
+
+    /**
+     * Executes the UPDATE or DELETE intermediate representation with a single
+     * SQL statement, without loading the records
+     */
+    protected function executeBulk(<ModelInterface> model, array intermediate, array bindParams, array bindTypes) -> <StatusInterface>
+    {
+        var connection, dialect, field, manager, schema, sql, table, value,
+            where, wildcard;
+        array bindCounts, definition, fields, processed, processedTypes,
+            values;
+
+        let table = intermediate["tables"][0];
+
+        /**
+         * Tables without an alias are only the source in the IR
+         */
+        if typeof table != "array" {
+            let schema = model->getSchema();
+
+            if schema {
+                let table = [model->getSource(), schema];
+            } else {
+                let table = [model->getSource(), null];
+            }
+        }
+
+        let processed      = [],
+            processedTypes = [],
+            bindCounts     = [];
+
+        for wildcard, value in bindParams {
+            if typeof wildcard == "integer" {
+                let wildcard = ":" . wildcard;
+            }
+
+            let processed[wildcard] = value;
+
+            if typeof value == "array" {
+                let bindCounts[wildcard] = count(value);
+            }
+        }
+
+        for wildcard, value in bindTypes {
+            if typeof wildcard == "integer" {
+                let wildcard = ":" . wildcard;
+            }
+
+            let processedTypes[wildcard] = value;
+        }
+
+        let definition = [
+            "tables"     : [table],
+            "bindCounts" : bindCounts
+        ];
+
+        if fetch where, intermediate["where"] {
+            let definition["where"] = where;
+        }
+
+        let connection = this->getWriteConnection(
+                model,
+                intermediate,
+                bindParams,
+                bindTypes
+            ),
+            dialect    = connection->getDialect();
+
+        if this->type == PHQL_T_UPDATE {
+            let fields = [],
+                values = [];
+
+            for field in intermediate["fields"] {
+                let fields[] = field["name"];
+            }
+
+            for value in intermediate["values"] {
+                let values[] = value["value"];
+            }
+
+            let definition["fields"] = fields,
+                definition["values"] = values,
+                sql                  = dialect->{"update"}(definition);
+        } else {
+            let sql = dialect->{"delete"}(definition);
+        }
+
+        connection->execute(sql, processed, processedTypes);
+
+        /**
+         * The records loaded before are not up to date anymore
+         */
+        let manager = this->manager;
+
+        if manager instanceof Manager {
+            manager->clearReusableObjects();
+            manager->bumpTableVersions([table], connection);
+            manager->clearIdentityMap(get_class(model));
+        }
+
+        return new Status(true, null, connection->affectedRows());
+    }
+
     /**
      * Executes the DELETE intermediate representation producing a
      * Phalcon\Mvc\Model\Query\Status
@@ -781,6 +1046,10 @@ class Query implements QueryInterface, InjectionAwareInterface
             let model = this->manager->load(modelName);
         }
 
+        if !isset intermediate["limit"] && this->bulk {
+            return this->executeBulk(model, intermediate, bindParams, bindTypes);
+        }
+
         /**
          * Get the records to be deleted
          */
@@ -840,10 +1109,14 @@ class Query implements QueryInterface, InjectionAwareInterface
          */
         connection->commit();
 
+        if this->manager instanceof Manager {
+            this->manager->flushTableVersions();
+        }
+
         /**
          * Create a status to report the deletion status
          */
-        return new Status(true);
+        return new Status(true, null, count(records));
     }
 
 
@@ -1393,6 +1666,10 @@ class Query implements QueryInterface, InjectionAwareInterface
             let model = this->manager->load(modelName);
         }
 
+        if !isset intermediate["limit"] && this->bulk {
+            return this->executeBulk(model, intermediate, bindParams, bindTypes);
+        }
+
         let connection = this->getWriteConnection(
             model,
             intermediate,
@@ -1534,7 +1811,11 @@ class Query implements QueryInterface, InjectionAwareInterface
          */
         connection->commit();
 
-        return new Status(true);
+        if this->manager instanceof Manager {
+            this->manager->flushTableVersions();
+        }
+
+        return new Status(true, null, count(records));
     }
 
     /**
@@ -3493,6 +3774,16 @@ class Query implements QueryInterface, InjectionAwareInterface
         return model->getWriteConnection();
     }
 
+    /**
+     * Loads the eager relations for the records of a resultset
+     */
+    protected function loadEagerRelations(var result) -> void
+    {
+        if count(this->eagerRelations) > 0 && result instanceof Simple {
+            result->with(this->eagerRelations);
+        }
+    }
+
     /**
      * Analyzes a DELETE intermediate code and produces an array to be executed
      * later
@@ -15,6 +15,7 @@ use Phalcon\Db\Column;
 use Phalcon\Di\DiInterface;
 use Phalcon\Mvc\Model\Exception;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Mvc\Model\Query;
 use Phalcon\Mvc\Model\QueryInterface;
 
 /**
@@ -48,6 +49,7 @@ use Phalcon\Mvc\Model\QueryInterface;
  *     "limit"      => 20,
  *     "offset"     => 20,
  *     // or "limit" => [20, 20],
+ *     "with"       => ["parts", "parts.type"],
  * ];
  *
  * $queryBuilder = new \Phalcon\Mvc\Model\Query\Builder($params);
@@ -135,6 +137,13 @@ class Builder implements BuilderInterface, InjectionAwareInterface
      */
     protected sharedLock = false;
 
+    /**
+     * Relations to load eagerly
+     *
+     * @var array
+     */
+    protected with = [];
+
     /**
      * Phalcon\Mvc\Model\Query\Builder constructor
      *
@@ -146,7 +155,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
         var conditions, columns, groupClause, havingClause, limitClause,
             forUpdate, sharedLock, orderClause, offsetClause, joinsClause,
             singleConditionArray, limit, offset, fromClause, singleCondition,
-            singleParams, singleTypes, distinct, bind, bindTypes;
+            singleParams, singleTypes, distinct, bind, bindTypes, withClause;
         array mergedConditions, mergedParams, mergedTypes;
 
         if typeof params == "array" {
@@ -295,6 +304,13 @@ class Builder implements BuilderInterface, InjectionAwareInterface
             if fetch sharedLock, params["shared_lock"] {
                 let this->sharedLock = sharedLock;
             }
+
+            /**
+             * Assign the relations to load eagerly
+             */
+            if fetch withClause, params["with"] {
+                this->with(withClause);
+            }
         } else {
             if typeof params == "string" && params !== "" {
                 let this->conditions = params;
@@ -1082,6 +1098,10 @@ class Builder implements BuilderInterface, InjectionAwareInterface
             query->setSharedLock(this->sharedLock);
         }
 
+        if count(this->with) > 0 && query instanceof Query {
+            query->setEagerRelations(this->with);
+        }
+
         return query;
     }
 
@@ -1095,6 +1115,14 @@ class Builder implements BuilderInterface, InjectionAwareInterface
         return this->conditions;
     }
 
+    /**
+     * Returns the relations to load eagerly
+     */
+    public function getWith() -> array
+    {
+        return this->with;
+    }
+
     /**
      * Sets a GROUP BY clause
      *
@@ -1581,6 +1609,40 @@ class Builder implements BuilderInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Loads relations of the resulting records eagerly, with one query per
+     * relation. Nested relations are separated by dots
+     *
+     *```php
+     * $builder->with(["parts", "parts.type"]);
+     *
+     * foreach ($builder->getQuery()->execute() as $robot) {
+     *     // No queries here
+     *     foreach ($robot->parts as $part) {
+     *         echo $part->type->name;
+     *     }
+     * }
+     *```
+     *
+     * @param array|string $relations
+     */
+    public function with(var relations) -> <BuilderInterface>
+    {
+        var relation;
+
+        if typeof relations !== "array" {
+            let relations = [relations];
+        }
+
+        for relation in relations {
+            if !in_array(relation, this->with, true) {
+                let this->with[] = relation;
+            }
+        }
+
+        return this;
+    }
+
     /**
      * Appends a BETWEEN condition
      */
@@ -42,6 +42,11 @@ use Phalcon\Mvc\ModelInterface;
  */
 class Status implements StatusInterface
 {
+    /**
+     * @var int
+     */
+    protected affectedRows = 0;
+
     /**
      * @var ModelInterface|null
      */
@@ -55,10 +60,21 @@ class Status implements StatusInterface
     /**
      * Phalcon\Mvc\Model\Query\Status
      */
-    public function __construct(bool success, <ModelInterface> model = null)
+    public function __construct(bool success, <ModelInterface> model = null, int affectedRows = 0)
+    {
+        let this->success      = success,
+            this->model        = model,
+            this->affectedRows = affectedRows;
+    }
+
+    /**
+     * Returns the number of rows updated or deleted. After a single
+     * statement UPDATE on MySQL, the rows matched but left unchanged are not
+     * counted unless the connection sets `PDO::MYSQL_ATTR_FOUND_ROWS`
+     */
+    public function getAffectedRows() -> int
     {
-        let this->success = success,
-            this->model = model;
+        return this->affectedRows;
     }
 
     /**
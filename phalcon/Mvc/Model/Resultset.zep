@@ -21,6 +21,7 @@ use Phalcon\Messages\MessageInterface;
 use Phalcon\Mvc\Model;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Storage\Serializer\SerializerInterface;
+use Phalcon\Support\Helper\Json\Encode;
 use SeekableIterator;
 use Serializable;
 
@@ -630,6 +631,25 @@ abstract class Resultset
         return this;
     }
 
+    /**
+     * Returns the rows of the resultset as a JSON array, the same as
+     * `json_encode($resultset->toArray(), $options)`
+     *
+     *```php
+     * echo $robots->toJson();
+     *```
+     *
+     * @throws \InvalidArgumentException if the rows cannot be encoded
+     */
+    public function toJson(int options = 0) -> string
+    {
+        var encode;
+
+        let encode = new Encode();
+
+        return encode->__invoke(this->toArray(), options);
+    }
+
     /**
      * Updates every record in the resultset
      *
@@ -14,6 +14,7 @@ use Phalcon\Di\Di;
 use Phalcon\Di\DiInterface;
 use Phalcon\Mvc\Model;
 use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\Resultset;
 use Phalcon\Mvc\Model\Row;
 use Phalcon\Mvc\ModelInterface;
@@ -35,6 +36,20 @@ class Simple extends Resultset
      */
     protected columnMap;
 
+    /**
+     * Records loaded eagerly, see with()
+     *
+     * @var array
+     */
+    protected eagerRelations = [];
+
+    /**
+     * Models manager keeping the identity map, false until it is checked
+     *
+     * @var Manager|null|false
+     */
+    protected identityManager = false;
+
     /**
      * @var ModelInterface|Row
      */
@@ -143,6 +158,17 @@ class Simple extends Resultset
                     );
                 }
 
+                /**
+                 * A record already loaded is replaced by the loaded instance
+                 */
+                if this->identityManager === false {
+                    let this->identityManager = this->getIdentityManager();
+                }
+
+                if this->identityManager !== null {
+                    let activeRow = this->identityManager->addIdentity(activeRow);
+                }
+
                 break;
 
             default:
@@ -158,11 +184,47 @@ class Simple extends Resultset
                 break;
         }
 
+        /**
+         * Attach the records loaded eagerly
+         */
+        if count(this->eagerRelations) > 0 && activeRow instanceof ModelInterface {
+            this->model->getModelsManager()->attachEagerRelations(
+                activeRow,
+                this->eagerRelations
+            );
+        }
+
         let this->activeRow = activeRow;
 
         return activeRow;
     }
 
+    /**
+     * Arrays are returned as toArray() does, without hydrating each row
+     */
+    public function jsonSerialize() -> array
+    {
+        var records;
+
+        if (
+            this->hydrateMode != Resultset::HYDRATE_ARRAYS ||
+            globals_get("orm.case_insensitive_column_map")
+        ) {
+            return parent::jsonSerialize();
+        }
+
+        let records = this->fetchRecords();
+
+        if typeof this->columnMap != "array" || !count(records) {
+            return records;
+        }
+
+        return phalcon_orm_rename_rows(
+            records,
+            this->getColumnHeader(records[0], false)
+        );
+    }
+
     /**
      * Returns a complete resultset as an array, if the resultset has a big
      * number of rows it could consume more memory than currently it does.
@@ -171,84 +233,73 @@ class Simple extends Resultset
      */
     public function toArray(bool renameColumns = true) -> array
     {
-        var result, records, record, renamedKey, key, value, columnMap;
-        array renamedRecords, renamed;
+        var records;
+
+        let records = this->fetchRecords();
 
         /**
-         * If _rows is not present, fetchAll from database
-         * and keep them in memory for further operations
+         * We need to rename the whole set here, the new keys are resolved
+         * once and applied to every row by position
+         *
+         * Only rename when it is Model
          */
-        let records = this->rows;
-
-        if typeof records != "array" {
-            let result = this->result;
-
-            if this->row !== null {
-                // re-execute query if required and fetchAll rows
-                result->execute();
+        if renameColumns && !(this->model instanceof Row) {
+            if typeof this->columnMap != "array" || !count(records) {
+                return records;
             }
 
-            let records = result->fetchAll();
-
-            let this->row = null;
-            let this->rows = records; // keep result-set in memory
+            return phalcon_orm_rename_rows(
+                records,
+                this->getColumnHeader(records[0], true)
+            );
         }
 
+        return records;
+    }
+
+    /**
+     * Returns the rows as a JSON array, the same as
+     * `json_encode($resultset->toArray(), $options)`. The JSON is written
+     * straight from the fetched rows, the renamed rows are not built
+     *
+     *```php
+     * echo $robots->toJson(JSON_UNESCAPED_UNICODE);
+     *```
+     *
+     * @throws \InvalidArgumentException if the rows cannot be encoded
+     */
+    public function toJson(int options = 0) -> string
+    {
+        var encoded, header, records;
+
         /**
-         * We need to rename the whole set here, this could be slow
-         *
-         * Only rename when it is Model
+         * The other layouts are left to json_encode()
          */
-        if renameColumns && !(this->model instanceof Row) {
-            /**
-             * Get the resultset column map
-             */
-            let columnMap = this->columnMap;
+        if options & (JSON_PRETTY_PRINT | JSON_FORCE_OBJECT) {
+            return parent::toJson(options);
+        }
 
-            if typeof columnMap != "array" {
-                return records;
-            }
+        let records = this->fetchRecords();
 
-            let renamedRecords = [];
-
-            if typeof records == "array" {
-                for record in records {
-                    let renamed = [];
-
-                    for key, value in record {
-                        if (typeof key === "string") {
-                            /**
-                             * Check if the key is part of the column map
-                             */
-                            if unlikely !fetch renamedKey, columnMap[key] {
-                                throw new Exception(
-                                    "Column '" . key . "' is not part of the column map"
-                                );
-                            }
-
-                            if typeof renamedKey == "array" {
-                                if unlikely !fetch renamedKey, renamedKey[0] {
-                                    throw new Exception(
-                                        "Column '" . key . "' is not part of the column map"
-                                    );
-                                }
-                            }
-
-                            let renamed[renamedKey] = value;
-                        }
-                    }
+        if !count(records) {
+            return "[]";
+        }
 
-                    /**
-                     * Append the renamed records to the main array
-                     */
-                    let renamedRecords[] = renamed;
-                }
-            }
+        let header  = this->getColumnHeader(
+                records[0],
+                true,
+                !(this->model instanceof Row)
+            ),
+            encoded = phalcon_orm_rows_to_json(records, header, options);
 
-            return renamedRecords;
+        if unlikely encoded === false {
+            /**
+             * Report the error as json_encode() does
+             */
+            return parent::toJson(options);
         }
 
-        return records;
+        return encoded;
     }
 
     /**
@@ -328,6 +379,179 @@ class Simple extends Resultset
         }
     }
 
+    /**
+     * Loads relations of the records eagerly, with one query per relation.
+     * Nested relations are separated by dots. The records are attached to
+     * each model as it is hydrated
+     *
+     *```php
+     * $robots = Robots::find()->with(["parts", "parts.type"]);
+     *```
+     *
+     * @param array|string $relations
+     *
+     * @return Simple
+     */
+    public function with(var relations) -> <Simple>
+    {
+        if !(this->model instanceof ModelInterface) || this->count == 0 {
+            return this;
+        }
+
+        if typeof relations !== "array" {
+            let relations = [relations];
+        }
+
+        let this->eagerRelations = this->model->getModelsManager()->getEagerRelations(
+            get_class(this->model),
+            this->toArray(),
+            relations
+        );
+
+        this->rewind();
+
+        return this;
+    }
+
+    /**
+     * Returns a resultset of the rows at the given positions, which shares
+     * the model, the column map and the relations loaded eagerly of this one
+     *
+     * @param array $positions
+     *
+     * @return Simple
+     */
+    public function slice(array positions) -> <Simple>
+    {
+        var position, records, resultset, row;
+        array rows;
+
+        let records = this->fetchRecords(),
+            rows    = [];
+
+        for position in positions {
+            if fetch row, records[position] {
+                let rows[] = row;
+            }
+        }
+
+        let resultset = clone this;
+
+        let resultset->rows      = rows,
+            resultset->count     = count(rows),
+            resultset->row       = null,
+            resultset->activeRow = null,
+            resultset->pointer   = 0;
+
+        return resultset;
+    }
+
+    /**
+     * Returns all the rows as fetched from the database. They are kept in
+     * memory for further operations
+     */
+    protected function fetchRecords() -> array
+    {
+        var records, result;
+
+        let records = this->rows;
+
+        if typeof records != "array" {
+            let result = this->result;
+
+            if this->row !== null {
+                // re-execute query if required and fetchAll rows
+                result->execute();
+            }
+
+            let records = result->fetchAll();
+
+            let this->row = null;
+            let this->rows = records; // keep result-set in memory
+        }
+
+        return records;
+    }
+
+    /**
+     * Returns the key of each column of a fetched row, in the order the
+     * columns are fetched, renamed through the column map when `rename` is
+     * set. Columns without a key are null
+     */
+    protected function getColumnHeader(array record, bool strict, bool rename = true) -> array
+    {
+        var columnMap, key, renamedKey;
+        array header;
+
+        let header    = [],
+            columnMap = this->columnMap;
+
+        if typeof columnMap != "array" {
+            let rename = false;
+        }
+
+        for key in array_keys(record) {
+            if typeof key !== "string" {
+                let header[] = null;
+
+                continue;
+            }
+
+            if !rename {
+                let header[] = key;
+
+                continue;
+            }
+
+            /**
+             * Check if the key is part of the column map
+             */
+            if !fetch renamedKey, columnMap[key] {
+                if unlikely (strict || !globals_get("orm.ignore_unknown_columns")) {
+                    throw new Exception(
+                        "Column '" . key . "' is not part of the column map"
+                    );
+                }
+
+                let header[] = null;
+
+                continue;
+            }
+
+            if typeof renamedKey == "array" {
+                if unlikely !fetch renamedKey, renamedKey[0] {
+                    throw new Exception(
+                        "Column '" . key . "' is not part of the column map"
+                    );
+                }
+            }
+
+            let header[] = renamedKey;
+        }
+
+        return header;
+    }
+
+    /**
+     * Returns the models manager if it keeps an identity map
+     */
+    protected function getIdentityManager() -> <Manager> | null
+    {
+        var manager;
+
+        if !(this->model instanceof ModelInterface) {
+            return null;
+        }
+
+        let manager = this->model->getModelsManager();
+
+        if manager instanceof Manager && manager->isUsingIdentityMap() {
+            return manager;
+        }
+
+        return null;
+    }
+
     public function __serialize() -> array
     {
         return [
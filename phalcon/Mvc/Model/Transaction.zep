@@ -73,6 +73,11 @@ class Transaction implements TransactionInterface
      */
     protected connection;
 
+    /**
+     * @var DiInterface
+     */
+    protected container;
+
     /**
      * @var bool
      */
@@ -114,7 +119,8 @@ class Transaction implements TransactionInterface
     {
         var connection;
 
-        let this->messages = [];
+        let this->messages  = [],
+            this->container = container;
 
         let connection = container->get(service);
 
@@ -138,7 +144,7 @@ class Transaction implements TransactionInterface
      */
     public function commit() -> bool
     {
-        var manager;
+        var manager, committed;
 
         let manager = this->manager;
 
@@ -146,7 +152,11 @@ class Transaction implements TransactionInterface
             manager->notifyCommit(this);
         }
 
-        return this->connection->commit();
+        let committed = this->connection->commit();
+
+        this->flushTableVersions();
+
+        return committed;
     }
 
     /**
@@ -192,7 +202,7 @@ class Transaction implements TransactionInterface
      */
     public function rollback(string rollbackMessage = null, <ModelInterface> rollbackRecord = null) -> bool
     {
-        var manager, connection;
+        var manager, connection, rolledBack;
 
         let manager = this->manager;
 
@@ -200,9 +210,12 @@ class Transaction implements TransactionInterface
             manager->notifyRollback(this);
         }
 
-        let connection = this->connection;
+        let connection = this->connection,
+            rolledBack = connection->rollback();
+
+        this->flushTableVersions();
 
-        if unlikely connection->rollback() {
+        if unlikely rolledBack {
             if !rollbackMessage {
                 let rollbackMessage = "Transaction aborted";
             }
@@ -260,4 +273,23 @@ class Transaction implements TransactionInterface
 
         return this;
     }
+
+    /**
+     * Changes again the version of the tables written within the transaction
+     * once it has ended
+     */
+    protected function flushTableVersions() -> void
+    {
+        var modelsManager;
+
+        if !this->container->has("modelsManager") {
+            return;
+        }
+
+        let modelsManager = this->container->getShared("modelsManager");
+
+        if modelsManager instanceof Manager {
+            modelsManager->flushTableVersions();
+        }
+    }
 }
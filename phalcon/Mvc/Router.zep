@@ -12,6 +12,7 @@ namespace Phalcon\Mvc;
 
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Http\RequestInterface;
@@ -48,7 +49,7 @@ use Phalcon\Mvc\Router\RouteInterface;
  * echo $router->getControllerName();
  * ```
  */
-class Router extends AbstractInjectionAware implements RouterInterface, EventsAwareInterface
+class Router extends AbstractInjectionAware implements RouterInterface, EventsAwareInterface, ResettableInterface
 {
     const POSITION_FIRST = 0;
     const POSITION_LAST = 1;
@@ -1113,6 +1114,22 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
         return this;
     }
 
+    /**
+     * Removes the result of the last matching, the routes and the defaults
+     * are kept
+     */
+    public function resetRequest() -> void
+    {
+        let this->action        = "",
+            this->controller    = "",
+            this->matchedRoute  = null,
+            this->matches       = [],
+            this->module        = "",
+            this->namespaceName = "",
+            this->params        = [],
+            this->wasMatched    = false;
+    }
+
     /**
      * Sets the default action name
      *
@@ -51,6 +51,15 @@ class Url extends AbstractInjectionAware implements UrlInterface
      */
     protected router = null;
 
+    /**
+     * Named routes compiled into literal segments and `[variable]` slots,
+     * keyed by route name. A route is compiled on its first use, later
+     * changes to the router are not seen
+     *
+     * @var array
+     */
+    protected routeTemplates = [];
+
     /**
      * @var null | string
      */
@@ -101,7 +110,7 @@ class Url extends AbstractInjectionAware implements UrlInterface
     public function get(var uri = null, var args = null, bool local = null, var baseUri = null) -> string
     {
         string strUri;
-        var router, container, routeName, route, queryString;
+        var routeName, queryString, segment, template, value;
 
         if local == null {
             if typeof uri == "string" && (memstr(uri, "//") || memstr(uri, ":")) {
@@ -126,54 +135,38 @@ class Url extends AbstractInjectionAware implements UrlInterface
                 );
             }
 
-            let router = this->router;
+            if !fetch template, this->routeTemplates[routeName] {
+                let template = this->compileRoute(routeName);
+            }
 
             /**
-             * Check if the router has not previously set
+             * Replace the slots of the template by the variables
              */
-            if unlikely !router {
-                let container = <DiInterface> this->container;
+            let strUri = "";
 
-                if unlikely typeof container != "object" {
-                    throw new Exception(
-                        "A dependency injection container is required to access the 'router' service"
-                    );
-                }
-
-                if unlikely !container->has("router") {
-                    throw new Exception(
-                        "A dependency injection container is required to access the 'router' service"
-                    );
+            for segment in template {
+                if typeof segment == "array" {
+                    if fetch value, uri[segment[0]] {
+                        let strUri .= value;
+                    }
+                } else {
+                    let strUri .= segment;
                 }
-
-                let router       = <RouterInterface> container->getShared("router"),
-                    this->router = router;
             }
 
-            /**
-             * Every route is uniquely differenced by a name
-             */
-            let route = <RouteInterface> router->getRouteByName(routeName);
+            let uri = strUri;
+        }
 
-            if unlikely typeof route != "object" {
-                throw new Exception(
-                    "Cannot obtain a route using the name '" . routeName . "'"
-                );
-            }
+        if local {
+            let strUri = (string) uri,
+                uri    = baseUri . strUri;
 
             /**
-             * Replace the patterns by its variables
+             * Only normalize the slashes when there is something to normalize
              */
-            let uri = phalcon_replace_paths(
-                route->getPattern(),
-                route->getReversedPaths(),
-                uri
-            );
-        }
-
-        if local {
-            let strUri = (string) uri;
-            let uri = preg_replace("#(?<!:)//+#", "/", baseUri . strUri);
+            if memstr(uri, "//") {
+                let uri = preg_replace("#(?<!:)//+#", "/", uri);
+            }
         }
 
         if args {
@@ -323,4 +316,234 @@ class Url extends AbstractInjectionAware implements UrlInterface
     {
         return this->basePath . path;
     }
+
+    /**
+     * Compiles a named route into literal segments and `[variable]` slots,
+     * scanning the pattern like `phalcon_replace_paths()` does
+     */
+    protected function compileRoute(var routeName) -> array
+    {
+        var container, key, paths, route, router, segment;
+        string pattern, literal;
+        char ch;
+        array compiled, segments;
+        int bracketCount = 0, cursor = 0, i = 0, intermediate = 0, length,
+            marker = 0, parenthesesCount = 0, position = 1;
+        bool placeholder = false;
+
+        let router = this->router;
+
+        /**
+         * Check if the router has not previously set
+         */
+        if unlikely !router {
+            let container = <DiInterface> this->container;
+
+            if unlikely typeof container != "object" {
+                throw new Exception(
+                    "A dependency injection container is required to access the 'router' service"
+                );
+            }
+
+            if unlikely !container->has("router") {
+                throw new Exception(
+                    "A dependency injection container is required to access the 'router' service"
+                );
+            }
+
+            let router       = <RouterInterface> container->getShared("router"),
+                this->router = router;
+        }
+
+        /**
+         * Every route is uniquely differenced by a name
+         */
+        let route = <RouteInterface> router->getRouteByName(routeName);
+
+        if unlikely typeof route != "object" {
+            throw new Exception(
+                "Cannot obtain a route using the name '" . routeName . "'"
+            );
+        }
+
+        let pattern  = (string) route->getPattern(),
+            paths    = route->getReversedPaths(),
+            length   = strlen(pattern),
+            segments = [],
+            literal  = "";
+
+        if length > 0 && pattern[0] == '/' {
+            let cursor = 1,
+                i      = 1;
+        }
+
+        if empty paths {
+            let segments[] = substr(pattern, i),
+                i          = length;
+        }
+
+        while i < length {
+            if cursor >= length {
+                break;
+            }
+
+            let ch = pattern[cursor];
+
+            /**
+             * Named variables: {name} or {name:regex}
+             */
+            if parenthesesCount == 0 && !placeholder {
+                if ch == '{' {
+                    if bracketCount == 0 {
+                        let marker       = cursor,
+                            intermediate = 0;
+                    }
+
+                    let bracketCount++;
+                } elseif ch == '}' {
+                    let bracketCount--;
+
+                    if intermediate > 0 && bracketCount == 0 {
+                        let key = this->getRouteKey(
+                            true,
+                            paths,
+                            position,
+                            substr(pattern, marker + 1, cursor - marker - 1)
+                        );
+
+                        if key !== false {
+                            let position++;
+                        }
+
+                        if typeof key == "string" {
+                            let segments[] = literal,
+                                segments[] = [key],
+                                literal    = "";
+                        }
+
+                        let cursor++,
+                            i++;
+
+                        continue;
+                    }
+                }
+            }
+
+            /**
+             * Groups: (regex)
+             */
+            if bracketCount == 0 && !placeholder {
+                if ch == '(' {
+                    if parenthesesCount == 0 {
+                        let marker       = cursor,
+                            intermediate = 0;
+                    }
+
+                    let parenthesesCount++;
+                } elseif ch == ')' {
+                    let parenthesesCount--;
+
+                    if intermediate > 0 && parenthesesCount == 0 {
+                        let key = this->getRouteKey(false, paths, position),
+                            position++;
+
+                        if typeof key == "string" {
+                            let segments[] = literal,
+                                segments[] = [key],
+                                literal    = "";
+                        }
+
+                        let cursor++,
+                            i++;
+
+                        continue;
+                    }
+                }
+            }
+
+            /**
+             * Placeholders: :controller, :action...
+             */
+            if bracketCount == 0 && parenthesesCount == 0 {
+                if placeholder {
+                    if intermediate > 0 && (ch < 'a' || ch > 'z' || i == length - 1) {
+                        let key = this->getRouteKey(false, paths, position),
+                            position++;
+
+                        if typeof key == "string" {
+                            let segments[] = literal,
+                                segments[] = [key],
+                                literal    = "";
+                        }
+
+                        let placeholder = false,
+                            i++;
+
+                        continue;
+                    }
+                } elseif ch == ':' {
+                    let placeholder  = true,
+                        marker       = cursor,
+                        intermediate = 0;
+                }
+            }
+
+            if bracketCount > 0 || parenthesesCount > 0 || placeholder {
+                let intermediate++;
+            } else {
+                let literal .= substr(pattern, cursor, 1);
+            }
+
+            let cursor++,
+                i++;
+        }
+
+        let segments[] = literal,
+            compiled   = [];
+
+        for segment in segments {
+            if segment !== "" {
+                let compiled[] = segment;
+            }
+        }
+
+        let this->routeTemplates[routeName] = compiled;
+
+        return compiled;
+    }
+
+    /**
+     * Returns the variable of a marker of a route: `false` if a named marker
+     * is not valid, `null` if there is no variable at this position
+     */
+    protected function getRouteKey(
+        bool named,
+        array paths,
+        int position,
+        string item = null
+    ) -> string | bool | null {
+        var key, matches;
+
+        if named {
+            let matches = [];
+
+            if !preg_match("/^([a-zA-Z][a-zA-Z0-9_-]*)(?::|$)/", item, matches) {
+                return false;
+            }
+
+            if !isset paths[position] {
+                return null;
+            }
+
+            return matches[1];
+        }
+
+        if fetch key, paths[position] {
+            if typeof key == "string" {
+                return key;
+            }
+        }
+
+        return null;
+    }
 }
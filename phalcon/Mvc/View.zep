@@ -13,6 +13,7 @@ namespace Phalcon\Mvc;
 use Closure;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\Injectable;
+use Phalcon\Di\ResettableInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Mvc\View\Exception;
 use Phalcon\Events\EventsAwareInterface;
@@ -44,7 +45,7 @@ use Phalcon\Mvc\View\Engine\Php as PhpEngine;
  * echo $view->getContent();
  * ```
  */
-class View extends Injectable implements ViewInterface, EventsAwareInterface
+class View extends Injectable implements ViewInterface, EventsAwareInterface, ResettableInterface
 {
     /**
      * Render Level: To the action view
@@ -775,6 +776,21 @@ class View extends Injectable implements ViewInterface, EventsAwareInterface
         return this;
     }
 
+    /**
+     * Resets the view component and removes the variables, the picked view
+     * and the disabled levels of the last request
+     */
+    public function resetRequest() -> void
+    {
+        this->reset();
+
+        let this->activeRenderPaths  = null,
+            this->currentRenderLevel = 0,
+            this->disabledLevels     = [],
+            this->pickView           = null,
+            this->viewParams         = [];
+    }
+
     /**
      * Sets base path. Depending of your platform, always add a trailing slash
      * or backslash
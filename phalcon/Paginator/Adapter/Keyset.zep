@@ -0,0 +1,515 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Paginator\Adapter;
+
+use Phalcon\Db\Enum;
+use Phalcon\Mvc\Model\Query\Builder;
+use Phalcon\Mvc\ModelInterface;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\RepositoryInterface;
+
+/**
+ * Phalcon\Paginator\Adapter\Keyset
+ *
+ * Keyset (seek) pagination using a PHQL query builder as source of data.
+ *
+ * Instead of an OFFSET, every page continues from the last row of the
+ * previous one: the builder is ordered by `columns`, which must be unique
+ * and not null as a whole, and the rows after the cursor are selected with
+ * `(a > :a) OR (a = :a AND b > :b)`. The cost of a page does not depend on
+ * its depth when the columns are indexed.
+ *
+ * The cursors of the next and previous pages are returned by the repository
+ * and must be passed back with the `cursor` option. The total is not
+ * counted unless the `count` option is `true` (exact) or `"estimate"`, which
+ * reads the row estimate of the query plan on MySQL and PostgreSQL.
+ *
+ * ```php
+ * use Phalcon\Paginator\Adapter\Keyset;
+ *
+ * $builder = $this->modelsManager->createBuilder()
+ *                 ->from(Robots::class)
+ *                 ->where("type = :type:", ["type" => "mechanical"]);
+ *
+ * $paginator = new Keyset(
+ *     [
+ *         "builder" => $builder,
+ *         "columns" => [
+ *             "year" => "DESC",
+ *             "id",
+ *         ],
+ *         "limit"   => 20,
+ *         "cursor"  => $this->request->getQuery("cursor"),
+ *     ]
+ * );
+ *
+ * $page = $paginator->paginate();
+ *
+ * $page->getNextCursor();
+ *```
+ */
+class Keyset extends AbstractAdapter
+{
+    const COUNT_ESTIMATE = "estimate";
+
+    /**
+     * @var Builder
+     */
+    protected builder;
+
+    /**
+     * Ordered columns, column => ASC|DESC
+     *
+     * @var array
+     */
+    protected columns = [];
+
+    /**
+     * false, true or "estimate"
+     *
+     * @var bool|string
+     */
+    protected count = false;
+
+    /**
+     * @var string|null
+     */
+    protected cursor = null;
+
+    /**
+     * Phalcon\Paginator\Adapter\Keyset
+     *
+     * @param array config = [
+     *     'limit'   => 10,
+     *     'builder' => null,
+     *     'columns' => [],
+     *     'cursor'  => null,
+     *     'count'   => false
+     * ]
+     */
+    public function __construct(array config)
+    {
+        var builder, column, columns, direction, value;
+
+        if unlikely !isset config["limit"] {
+            throw new Exception("Parameter 'limit' is required");
+        }
+
+        if unlikely !fetch builder, config["builder"] {
+            throw new Exception("Parameter 'builder' is required");
+        }
+
+        if unlikely !(builder instanceof Builder) {
+            throw new Exception(
+                "Parameter 'builder' must be an instance " .
+                "of Phalcon\\Mvc\\Model\\Query\\Builder"
+            );
+        }
+
+        if !fetch columns, config["columns"] {
+            let columns = null;
+        }
+
+        if unlikely (typeof columns !== "array" || empty columns) {
+            throw new Exception("Parameter 'columns' is required");
+        }
+
+        for column, direction in columns {
+            if typeof column === "integer" {
+                let column    = direction,
+                    direction = "ASC";
+            }
+
+            let direction = strtoupper(direction);
+
+            if unlikely (direction !== "ASC" && direction !== "DESC") {
+                throw new Exception(
+                    "The direction of the column '" . column . "' must be ASC or DESC"
+                );
+            }
+
+            let this->columns[column] = direction;
+        }
+
+        if fetch value, config["cursor"] {
+            this->setCursor(value);
+        }
+
+        if fetch value, config["count"] {
+            let this->count = value;
+        }
+
+        parent::__construct(config);
+
+        this->setQueryBuilder(builder);
+    }
+
+    /**
+     * Get the cursor of the current page
+     */
+    public function getCursor() -> string | null
+    {
+        return this->cursor;
+    }
+
+    /**
+     * Get query builder object
+     */
+    public function getQueryBuilder() -> <Builder>
+    {
+        return this->builder;
+    }
+
+    /**
+     * Returns the page after (or before) the cursor
+     */
+    public function paginate() -> <RepositoryInterface>
+    {
+        var backward, boundary, builder, cursor, items, last, limit, next,
+            previous, values;
+        int count;
+
+        let limit    = this->limitRows,
+            cursor   = this->decodeCursor(),
+            backward = false,
+            values   = null,
+            previous = null,
+            next     = null;
+
+        if cursor !== null {
+            let backward = cursor[0] === "p",
+                values   = cursor[1];
+        }
+
+        if backward {
+            /**
+             * The rows before the cursor are the first ones in reverse
+             * order. The earliest of them is the start of the page, the
+             * page itself is selected in the regular order
+             */
+            let builder = this->getPageBuilder(values, true, false);
+
+            builder->limit(limit + 1);
+
+            let items = builder->getQuery()->execute(),
+                count = count(items);
+
+            if count == 0 {
+                let builder = this->getPageBuilder(null, false, false);
+            } else {
+                if count > limit {
+                    let count = limit;
+                }
+
+                items->seek(count - 1);
+
+                let boundary = this->getRowValues(items->current()),
+                    builder  = this->getPageBuilder(boundary, false, true);
+
+                if count(items) > limit {
+                    let previous = this->encodeCursor("p", boundary);
+                }
+            }
+        } else {
+            let builder = this->getPageBuilder(values, false, false);
+
+            if values !== null {
+                let previous = true;
+            }
+        }
+
+        builder->limit(limit);
+
+        let items = builder->getQuery()->execute(),
+            count = count(items);
+
+        if count > 0 {
+            if previous === true {
+                let previous = this->encodeCursor(
+                    "p",
+                    this->getRowValues(items->getFirst())
+                );
+            }
+
+            items->seek(count - 1);
+
+            let last = this->getRowValues(items->current());
+
+            items->rewind();
+
+            /**
+             * A full page has a next one only if a row follows its last
+             * row. The page itself cannot hold one row more, so the row is
+             * fetched apart, as the first row of the next page
+             */
+            if count == limit {
+                let builder = this->getPageBuilder(last, false, false);
+
+                builder->limit(1);
+
+                if count(builder->getQuery()->execute()) > 0 {
+                    let next = this->encodeCursor("n", last);
+                }
+            }
+        } else {
+            let previous = null;
+        }
+
+        return this->getRepository(
+            [
+                RepositoryInterface::PROPERTY_ITEMS           : items,
+                RepositoryInterface::PROPERTY_TOTAL_ITEMS     : this->getTotal(),
+                RepositoryInterface::PROPERTY_LIMIT           : limit,
+                RepositoryInterface::PROPERTY_NEXT_CURSOR     : next,
+                RepositoryInterface::PROPERTY_PREVIOUS_CURSOR : previous
+            ]
+        );
+    }
+
+    /**
+     * Set the cursor, `null` for the first page
+     */
+    public function setCursor(var cursor) -> <Keyset>
+    {
+        if cursor === "" {
+            let cursor = null;
+        }
+
+        let this->cursor = cursor;
+
+        return this;
+    }
+
+    /**
+     * Set query builder object
+     */
+    public function setQueryBuilder(<Builder> builder) -> <Keyset>
+    {
+        let this->builder = builder;
+
+        return this;
+    }
+
+    /**
+     * Returns `[direction, values]` from the cursor or null for the first
+     * page
+     */
+    protected function decodeCursor() -> array | null
+    {
+        var decoded;
+
+        if this->cursor === null {
+            return null;
+        }
+
+        let decoded = json_decode(
+            (string) base64_decode(strtr(this->cursor, "-_", "+/"), true),
+            true
+        );
+
+        if unlikely (
+            typeof decoded !== "array" ||
+            !isset decoded[0] ||
+            !isset decoded[1] ||
+            (decoded[0] !== "n" && decoded[0] !== "p") ||
+            typeof decoded[1] !== "array" ||
+            count(decoded[1]) !== count(this->columns)
+        ) {
+            throw new Exception("The cursor is not valid");
+        }
+
+        return decoded;
+    }
+
+    /**
+     * Returns an opaque cursor
+     */
+    protected function encodeCursor(string direction, array values) -> string
+    {
+        return rtrim(
+            strtr(base64_encode(json_encode([direction, values])), "+/", "-_"),
+            "="
+        );
+    }
+
+    /**
+     * Returns a copy of the builder ordered by the keyset columns and
+     * limited to the rows after `values`, or before them when `reverse`
+     * is set
+     */
+    protected function getPageBuilder(var values, bool reverse, bool inclusive) -> <Builder>
+    {
+        var builder, column, direction, operator, orders, params, previous,
+            terms;
+        array bind, conditions;
+        int position, number;
+
+        let builder    = clone this->builder,
+            orders     = [],
+            conditions = [],
+            bind       = [],
+            previous   = [],
+            position   = 0,
+            number     = count(this->columns);
+
+        for column, direction in this->columns {
+            if reverse {
+                let direction = direction === "ASC" ? "DESC" : "ASC";
+            }
+
+            let orders[] = column . " " . direction;
+
+            if values !== null {
+                let params   = "AKS" . position,
+                    operator = direction === "ASC" ? " > " : " < ";
+
+                if inclusive && position == number - 1 {
+                    let operator = direction === "ASC" ? " >= " : " <= ";
+                }
+
+                let bind[params] = values[position],
+                    terms        = previous,
+                    terms[]      = column . operator . ":" . params . ":",
+                    conditions[] = "(" . implode(" AND ", terms) . ")",
+                    previous[]   = column . " = :" . params . ":";
+            }
+
+            let position++;
+        }
+
+        if count(conditions) {
+            builder->andWhere(implode(" OR ", conditions), bind);
+        }
+
+        builder->orderBy(implode(", ", orders));
+
+        return builder;
+    }
+
+    /**
+     * Returns the values of the keyset columns in a row
+     */
+    protected function getRowValues(var row) -> array
+    {
+        var column, direction, property, value;
+        array values;
+
+        let values = [];
+
+        for column, direction in this->columns {
+            /**
+             * "[Robots].id" and "r.id" are read as "id"
+             */
+            let property = str_replace(
+                ["[", "]"],
+                "",
+                column
+            );
+
+            if strpos(property, ".") !== false {
+                let property = substr(strrchr(property, "."), 1);
+            }
+
+            if typeof row === "array" {
+                if unlikely !fetch value, row[property] {
+                    throw new Exception(
+                        "The column '" . column . "' is not part of the result"
+                    );
+                }
+            } elseif row instanceof ModelInterface {
+                let value = row->readAttribute(property);
+            } else {
+                let value = row->{property};
+            }
+
+            if unlikely value === null {
+                throw new Exception(
+                    "The column '" . column . "' cannot be null"
+                );
+            }
+
+            let values[] = value;
+        }
+
+        return values;
+    }
+
+    /**
+     * Counts or estimates the rows of the query, 0 if it is not counted
+     */
+    protected function getTotal() -> int
+    {
+        var builder, connection, model, modelClass, plan, row, sql;
+
+        if !this->count {
+            return 0;
+        }
+
+        let builder = clone this->builder;
+
+        builder->orderBy(null);
+
+        if this->count === self::COUNT_ESTIMATE {
+            let modelClass = builder->getModels();
+
+            if typeof modelClass == "array" {
+                let modelClass = array_values(modelClass)[0];
+            }
+
+            if unlikely modelClass === null {
+                throw new Exception("Model not defined in builder");
+            }
+
+            let model      = create_instance(modelClass),
+                connection = model->getReadConnection(),
+                sql        = builder->getQuery()->getSql();
+
+            switch connection->getType() {
+                case "mysql":
+                    let row = connection->fetchOne(
+                        "EXPLAIN " . sql["sql"],
+                        Enum::FETCH_ASSOC,
+                        sql["bind"],
+                        sql["bindTypes"]
+                    );
+
+                    if row {
+                        return (int) round(row["rows"] * row["filtered"] / 100);
+                    }
+
+                    return 0;
+
+                case "pgsql":
+                    let row = connection->fetchOne(
+                        "EXPLAIN (FORMAT JSON) " . sql["sql"],
+                        Enum::FETCH_NUM,
+                        sql["bind"],
+                        sql["bindTypes"]
+                    );
+
+                    let plan = json_decode(row[0], true);
+
+                    return (int) plan[0]["Plan"]["Plan Rows"];
+            }
+
+            /**
+             * No estimate, count the rows
+             */
+        }
+
+        let row = builder->columns("COUNT(*) [rowcount]")
+            ->getQuery()
+            ->execute()
+            ->getFirst();
+
+        return row ? intval(row->rowcount) : 0;
+    }
+}
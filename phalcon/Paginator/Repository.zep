@@ -102,6 +102,15 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_LIMIT, 0);
     }
 
+    /**
+     * Returns the cursor of the next page of a keyset paginator, null on the
+     * last page
+     */
+    public function getNextCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_NEXT_CURSOR, null);
+    }
+
     /**
      * {@inheritdoc}
      */
@@ -118,6 +127,15 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_PREVIOUS_PAGE, 0);
     }
 
+    /**
+     * Returns the cursor of the previous page of a keyset paginator, null on
+     * the first page
+     */
+    public function getPreviousCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_PREVIOUS_CURSOR, null);
+    }
+
     /**
      * {@inheritdoc}
      */
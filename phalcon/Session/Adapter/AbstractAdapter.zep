@@ -12,14 +12,28 @@ namespace Phalcon\Session\Adapter;
 
 use Phalcon\Storage\Adapter\AdapterInterface;
 use SessionHandlerInterface;
+use SessionUpdateTimestampHandlerInterface;
 
-abstract class AbstractAdapter implements SessionHandlerInterface
+/**
+ * Session adapters on top of the storage adapters.
+ *
+ * The data read for each session is kept so that unchanged data is not
+ * written back at the end of the request: only its lifetime is renewed.
+ */
+abstract class AbstractAdapter implements SessionHandlerInterface, SessionUpdateTimestampHandlerInterface
 {
     /**
      * @var AdapterInterface
      */
     protected adapter;
 
+    /**
+     * Data read or written by session id
+     *
+     * @var array
+     */
+    protected data = [];
+
     /**
      * Close
      */
@@ -33,6 +47,8 @@ abstract class AbstractAdapter implements SessionHandlerInterface
      */
     public function destroy(var id) -> bool
     {
+        unset this->data[id];
+
         if !empty(id) && this->adapter->has(id) {
             return this->adapter->delete(id);
         }
@@ -59,7 +75,13 @@ abstract class AbstractAdapter implements SessionHandlerInterface
         var data;
         let data = this->adapter->get(id);
 
-        return null === data ? "" : data;
+        if null === data {
+            let data = "";
+        }
+
+        let this->data[id] = data;
+
+        return data;
     }
 
     /**
@@ -71,13 +93,44 @@ abstract class AbstractAdapter implements SessionHandlerInterface
     }
 
     /**
-     * Write
+     * Renews the lifetime of unchanged data
      */
-    public function write(var id, var data) -> bool
+    public function updateTimestamp(var id, var data) -> bool
     {
         return this->adapter->set(id, data);
     }
 
+    /**
+     * Checks if a session id exists, used when `session.use_strict_mode`
+     * is enabled
+     */
+    public function validateId(var id) -> bool
+    {
+        return this->adapter->has(id);
+    }
+
+    /**
+     * Write. Data unchanged since it was read only has its lifetime renewed
+     */
+    public function write(var id, var data) -> bool
+    {
+        var previous;
+
+        if fetch previous, this->data[id] {
+            if previous === data {
+                return this->updateTimestamp(id, data);
+            }
+        }
+
+        if !this->adapter->set(id, data) {
+            return false;
+        }
+
+        let this->data[id] = data;
+
+        return true;
+    }
+
     /**
      * @todo Remove this when we get traits
      */
@@ -41,4 +41,17 @@ class Libmemcached extends AbstractAdapter
         let options["prefix"] = this->getArrVal(options, "prefix", "sess-memc-"),
             this->adapter     = factory->newInstance("libmemcached", options);
     }
+
+    /**
+     * Renews the lifetime of unchanged data without sending it. The data is
+     * written again if the key has expired or has been evicted meanwhile
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        if this->adapter->getAdapter()->touch(id, this->adapter->getLifetime()) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
+    }
 }
@@ -4,7 +4,7 @@
  *
  * (c) Phalcon Team <team@phalcon.io>
  *
- * For the full copyright and license information, please view the LICENSE
+ * For the full copyright and license information, please view the LICENSE.txt
  * file that was distributed with this source code.
  */
 
@@ -14,9 +14,21 @@ use Phalcon\Storage\AdapterFactory;
 
 /**
  * Phalcon\Session\Adapter\Redis
+ *
+ * Sessions are not locked. When the stored data has been changed by another
+ * request since it was read, the keys changed by the current request are
+ * merged into it: the write is retried with `WATCH` until no other request
+ * wrote in between
  */
  class Redis extends AbstractAdapter
 {
+    /**
+     * Write attempts before giving up
+     *
+     * @var int
+     */
+    protected maxAttempts = 16;
+
     /**
      * Constructor
      *
@@ -36,4 +48,143 @@ use Phalcon\Storage\AdapterFactory;
         let options["prefix"] = this->getArrVal(options, "prefix", "sess-reds-"),
             this->adapter     = factory->newInstance("redis", options);
     }
+
+    /**
+     * Renews the lifetime of unchanged data without sending it. The data is
+     * written again if the key has expired or has been removed meanwhile
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        if this->adapter->getAdapter()->expire(id, this->adapter->getLifetime()) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
+    }
+
+    /**
+     * Write. Data unchanged since it was read only has its lifetime renewed,
+     * changes are merged into the data written meanwhile by other requests
+     */
+    public function write(var id, var data) -> bool
+    {
+        var connection, current, previous, result, value;
+        int attempt = 0;
+
+        if !fetch previous, this->data[id] {
+            return parent::write(id, data);
+        }
+
+        if previous === data {
+            return this->updateTimestamp(id, data);
+        }
+
+        let connection = this->adapter->getAdapter();
+
+        while attempt < this->maxAttempts {
+            let attempt++;
+
+            connection->watch(id);
+
+            let current = this->adapter->get(id);
+
+            if null === current {
+                let current = "";
+            }
+
+            if current === previous {
+                let value = data;
+            } else {
+                let value = this->merge(previous, data, current);
+            }
+
+            connection->multi();
+
+            this->adapter->set(id, value);
+
+            let result = connection->exec();
+
+            /**
+             * exec() fails if the session was written after WATCH
+             */
+            if typeof result === "array" {
+                let this->data[id] = value;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Applies the keys changed between `previous` and `data` to `current`.
+     * Returns `data` if the session data cannot be decoded
+     *
+     * @param string $previous
+     * @param string $data
+     * @param string $current
+     *
+     * @return string
+     */
+    protected function merge(string previous, string data, string current) -> string
+    {
+        var backup, changed, key, merged, original, value;
+
+        if session_status() !== PHP_SESSION_ACTIVE {
+            return data;
+        }
+
+        let backup = _SESSION;
+
+        let _SESSION = [];
+        if !session_decode(previous) {
+            let _SESSION = backup;
+
+            return data;
+        }
+        let original = _SESSION;
+
+        let _SESSION = [];
+        if !session_decode(data) {
+            let _SESSION = backup;
+
+            return data;
+        }
+        let changed = _SESSION;
+
+        let _SESSION = [];
+        if !session_decode(current) {
+            let _SESSION = backup;
+
+            return data;
+        }
+        let merged = _SESSION;
+
+        for key, value in changed {
+            if (
+                !array_key_exists(key, original) ||
+                serialize(original[key]) !== serialize(value)
+            ) {
+                let merged[key] = value;
+            }
+        }
+
+        for key, value in original {
+            if !array_key_exists(key, changed) {
+                unset merged[key];
+            }
+        }
+
+        let _SESSION = merged,
+            value    = session_encode();
+
+        let _SESSION = backup;
+
+        if false === value {
+            return data;
+        }
+
+        return value;
+    }
 }
@@ -11,6 +11,7 @@
 namespace Phalcon\Session\Adapter;
 
 use Phalcon\Session\Exception;
+use SessionUpdateTimestampHandlerInterface;
 
 /**
  * Phalcon\Session\Adapter\Stream
@@ -32,12 +33,22 @@ use Phalcon\Session\Exception;
  * $session->setAdapter($files);
  * ```
  *
+ * Data unchanged since it was read is not written back, only the
+ * modification time of the file is renewed, so no exclusive lock is taken.
+ *
  * @property array  $options
  * @property string $prefix
  * @property string $path
  */
-class Stream extends Noop
+class Stream extends Noop implements SessionUpdateTimestampHandlerInterface
 {
+    /**
+     * Data read or written by session id
+     *
+     * @var array
+     */
+    protected data = [];
+
     /**
      * @var string
      */
@@ -80,6 +91,8 @@ class Stream extends Noop
 
         let file = this->path . this->getPrefixedName(id);
 
+        unset this->data[id];
+
         if file_exists(file) && is_file(file) {
             unlink(file);
         }
@@ -154,20 +167,62 @@ class Stream extends Noop
             fclose(pointer);
 
             if false === data {
-                return "";
+                let data = "";
             }
         }
 
+        let this->data[id] = data;
+
         return data;
     }
 
-    public function write(var id, var data) -> bool
+    /**
+     * Renews the modification time of the file of unchanged data
+     */
+    public function updateTimestamp(var id, var data) -> bool
     {
         var name;
 
         let name = this->path . this->getPrefixedName(id);
 
-        return false !== this->phpFilePutContents(name, data, LOCK_EX);
+        if true !== this->phpFileExists(name) {
+            return false !== this->phpFilePutContents(name, data, LOCK_EX);
+        }
+
+        return touch(name);
+    }
+
+    /**
+     * Checks if a session id exists, used when `session.use_strict_mode`
+     * is enabled
+     */
+    public function validateId(var id) -> bool
+    {
+        return this->phpFileExists(this->path . this->getPrefixedName(id));
+    }
+
+    /**
+     * Write. Data unchanged since it was read only has its file touched
+     */
+    public function write(var id, var data) -> bool
+    {
+        var name, previous;
+
+        if fetch previous, this->data[id] {
+            if previous === data {
+                return this->updateTimestamp(id, data);
+            }
+        }
+
+        let name = this->path . this->getPrefixedName(id);
+
+        if false === this->phpFilePutContents(name, data, LOCK_EX) {
+            return false;
+        }
+
+        let this->data[id] = data;
+
+        return true;
     }
 
     /**
@@ -21,6 +21,7 @@ use Phalcon\Support\Helper\Arr\Get;
  * @property SessionHandlerInterface|null $adapter
  * @property string                       $name
  * @property array                        $options
+ * @property bool                         $readOnly
  * @property string                       $uniqueId
  */
 class Manager extends AbstractInjectionAware implements ManagerInterface
@@ -40,6 +41,13 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     private options = [];
 
+    /**
+     * Whether the session was started read-only
+     *
+     * @var bool
+     */
+    private readOnly = false;
+
     /**
      * @var string
      */
@@ -112,6 +120,8 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
 
             let _SESSION = [];
         }
+
+        let this->readOnly = false;
     }
 
     /**
@@ -139,7 +149,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
 
         let value = null;
 
-        if (false === this->exists()) {
+        if (false === this->readOnly && false === this->exists()) {
             // To use $_SESSION variable we need to start session first
             return value;
         }
@@ -189,7 +199,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey;
 
-        if false === this->exists() {
+        if false === this->readOnly && false === this->exists() {
             // To use $_SESSION variable we need to start session first
             return false;
         }
@@ -207,6 +217,14 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
         return this->options;
     }
 
+    /**
+     * Checks if the session was started read-only
+     */
+    public function isReadOnly() -> bool
+    {
+        return this->readOnly;
+    }
+
     /**
      * Regenerates the session id using the adapter.
      */
@@ -312,9 +330,19 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
 
     /**
      * Starts the session (if headers are already sent the session will not be
-     * started)
+     * started).
+     *
+     * A read-only session is read and closed at once (`read_and_close`): it
+     * is neither locked nor written back, its variables can be read but not
+     * changed. Starting it again without `readOnly` opens it for writing
+     *
+     * ```php
+     * $session->start(true);
+     *
+     * $user = $session->get("user");
+     * ```
      */
-    public function start() -> bool
+    public function start(bool readOnly = false) -> bool
     {
         var name, value;
 
@@ -356,6 +384,18 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
         /**
          * Start the session
          */
+        if readOnly {
+            let this->readOnly = session_start(
+                [
+                    "read_and_close" : true
+                ]
+            );
+
+            return this->readOnly;
+        }
+
+        let this->readOnly = false;
+
         return session_start();
     }
 
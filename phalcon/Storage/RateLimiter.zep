@@ -0,0 +1,498 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Storage;
+
+use Phalcon\Storage\Adapter\AdapterInterface;
+use Phalcon\Storage\Adapter\Apcu;
+use Phalcon\Storage\Adapter\Libmemcached;
+use Phalcon\Storage\Adapter\Redis;
+
+/**
+ * Rate limiter on top of the storage adapters.
+ *
+ * Two algorithms are available:
+ *
+ * - `TOKEN_BUCKET`: `limit` tokens per `interval` seconds, refilled
+ *   continuously (implemented as GCRA, so the state is a single number)
+ * - `SLIDING_WINDOW`: a log of the timestamps of the last `interval` seconds
+ *
+ * Every check is one atomic operation on the backend: a Lua script for
+ * Redis, a compare-and-swap loop for Libmemcached and `apcu_cas()` for APCu
+ * (token bucket only). Any other adapter uses plain get/set, which is only
+ * safe for process local adapters such as Memory.
+ *
+ *```php
+ * use Phalcon\Storage\RateLimiter;
+ *
+ * $limiter = new RateLimiter($redis, 100, 60);
+ *
+ * if (true !== $limiter->consume("api:" . $request->getClientAddress())) {
+ *     $response->setStatusCode(429);
+ *     $response->setHeader("Retry-After", $limiter->getRetryAfter());
+ * }
+ *```
+ */
+class RateLimiter
+{
+    const SLIDING_WINDOW = "slidingWindow";
+    const TOKEN_BUCKET   = "tokenBucket";
+
+    /**
+     * @var AdapterInterface
+     */
+    protected adapter;
+
+    /**
+     * @var string
+     */
+    protected algorithm;
+
+    /**
+     * Interval in seconds
+     *
+     * @var int
+     */
+    protected interval;
+
+    /**
+     * @var int
+     */
+    protected limit;
+
+    /**
+     * Compare-and-swap attempts before giving up
+     *
+     * @var int
+     */
+    protected maxAttempts = 16;
+
+    /**
+     * @var int
+     */
+    protected remaining = 0;
+
+    /**
+     * Microseconds until the last rejected request could succeed
+     *
+     * @var int
+     */
+    protected retryAfter = 0;
+
+    /**
+     * RateLimiter constructor.
+     *
+     * @param AdapterInterface $adapter
+     * @param int              $limit
+     * @param int              $interval
+     * @param string           $algorithm
+     *
+     * @throws Exception
+     */
+    public function __construct(
+        <AdapterInterface> adapter,
+        int limit,
+        int interval,
+        string algorithm = self::TOKEN_BUCKET
+    ) {
+        if unlikely (limit < 1 || interval < 1) {
+            throw new Exception(
+                "The limit and the interval must be greater than zero"
+            );
+        }
+
+        if unlikely (
+            algorithm !== self::TOKEN_BUCKET &&
+            algorithm !== self::SLIDING_WINDOW
+        ) {
+            throw new Exception(
+                "The algorithm '" . algorithm . "' is not supported"
+            );
+        }
+
+        if unlikely (
+            algorithm === self::SLIDING_WINDOW &&
+            adapter instanceof Apcu
+        ) {
+            throw new Exception(
+                "The sliding window algorithm is not supported by the Apcu adapter"
+            );
+        }
+
+        let this->adapter   = adapter,
+            this->algorithm = algorithm,
+            this->interval  = interval,
+            this->limit     = limit,
+            this->remaining = limit;
+    }
+
+    /**
+     * Takes `tokens` from the bucket of `key`. Returns `false` if the limit
+     * has been reached, in which case nothing is taken.
+     *
+     * @param string $key
+     * @param int    $tokens
+     *
+     * @return bool
+     * @throws Exception
+     */
+    public function consume(string key, int tokens = 1) -> bool
+    {
+        var result;
+
+        if this->adapter instanceof Redis {
+            let result = this->consumeRedis(key, tokens);
+        } elseif this->adapter instanceof Libmemcached {
+            let result = this->consumeLibmemcached(key, tokens);
+        } elseif this->adapter instanceof Apcu {
+            let result = this->consumeApcu(key, tokens);
+        } else {
+            let result = this->consumeAdapter(key, tokens);
+        }
+
+        let this->remaining  = (int) max(0, result[1]),
+            this->retryAfter = (int) max(0, result[2]);
+
+        return (bool) result[0];
+    }
+
+    /**
+     * @return string
+     */
+    public function getAlgorithm() -> string
+    {
+        return this->algorithm;
+    }
+
+    /**
+     * @return int
+     */
+    public function getInterval() -> int
+    {
+        return this->interval;
+    }
+
+    /**
+     * @return int
+     */
+    public function getLimit() -> int
+    {
+        return this->limit;
+    }
+
+    /**
+     * Tokens left after the last call to consume()
+     *
+     * @return int
+     */
+    public function getRemaining() -> int
+    {
+        return this->remaining;
+    }
+
+    /**
+     * Seconds until the last rejected request could succeed, 0 if it was
+     * accepted
+     *
+     * @return int
+     */
+    public function getRetryAfter() -> int
+    {
+        return (int) ceil(this->retryAfter / 1000000);
+    }
+
+    /**
+     * Clears the state of `key`
+     *
+     * @param string $key
+     *
+     * @return bool
+     */
+    public function reset(string key) -> bool
+    {
+        return this->adapter->delete(key);
+    }
+
+    /**
+     * Generic get/set implementation
+     *
+     * @param string $key
+     * @param int    $tokens
+     *
+     * @return array
+     */
+    protected function consumeAdapter(string key, int tokens) -> array
+    {
+        var result;
+
+        let result = this->process(this->adapter->get(key), tokens);
+
+        if result[0] {
+            this->adapter->set(key, result[3], this->getTtl());
+        }
+
+        return result;
+    }
+
+    /**
+     * APCu implementation, `apcu_cas()` only swaps integers which is
+     * enough for the token bucket state
+     *
+     * @param string $key
+     * @param int    $tokens
+     *
+     * @return array
+     */
+    protected function consumeApcu(string key, int tokens) -> array
+    {
+        var prefixed, result, stored;
+        int attempt = 0;
+
+        let prefixed = this->adapter->getPrefix() . key;
+
+        while attempt < this->maxAttempts {
+            let attempt++,
+                stored = apcu_fetch(prefixed),
+                result = this->process(stored, tokens);
+
+            if !result[0] {
+                return result;
+            }
+
+            if false === stored {
+                if apcu_add(prefixed, result[3], this->getTtl()) {
+                    return result;
+                }
+            } elseif apcu_cas(prefixed, (int) stored, (int) result[3]) {
+                return result;
+            }
+        }
+
+        throw new Exception("Cannot update the rate limiter state for " . key);
+    }
+
+    /**
+     * Libmemcached implementation, using CAS tokens
+     *
+     * @param string $key
+     * @param int    $tokens
+     *
+     * @return array
+     */
+    protected function consumeLibmemcached(string key, int tokens) -> array
+    {
+        var connection, result, stored;
+        int attempt = 0;
+
+        let connection = this->adapter->getAdapter();
+
+        while attempt < this->maxAttempts {
+            let attempt++,
+                stored = connection->get(key, null, \Memcached::GET_EXTENDED);
+
+            if false === stored {
+                let result = this->process(null, tokens);
+
+                if !result[0] || connection->add(key, result[3], this->getTtl()) {
+                    return result;
+                }
+
+                continue;
+            }
+
+            let result = this->process(stored["value"], tokens);
+
+            if !result[0] || connection->cas(stored["cas"], key, result[3], this->getTtl()) {
+                return result;
+            }
+        }
+
+        throw new Exception("Cannot update the rate limiter state for " . key);
+    }
+
+    /**
+     * Redis implementation, one Lua script per check. The script uses the
+     * server time so that all the clients share the same clock
+     *
+     * @param string $key
+     * @param int    $tokens
+     *
+     * @return array
+     */
+    protected function consumeRedis(string key, int tokens) -> array
+    {
+        var connection, result, script, serializer;
+
+        let connection = this->adapter->getAdapter();
+
+        if this->algorithm === self::SLIDING_WINDOW {
+            let script = "local t = redis.call('TIME')\n"
+                . "local now = tonumber(t[1]) * 1000000 + tonumber(t[2])\n"
+                . "local period = tonumber(ARGV[1])\n"
+                . "local limit = tonumber(ARGV[2])\n"
+                . "local cost = tonumber(ARGV[3])\n"
+                . "redis.call('ZREMRANGEBYSCORE', KEYS[1], '-inf', now - period)\n"
+                . "local count = redis.call('ZCARD', KEYS[1])\n"
+                . "if count + cost > limit then\n"
+                . "  local retry = period\n"
+                . "  if cost <= limit then\n"
+                . "    local oldest = redis.call('ZRANGE', KEYS[1], count + cost - limit - 1, count + cost - limit - 1, 'WITHSCORES')\n"
+                . "    if oldest[2] then retry = tonumber(oldest[2]) + period - now end\n"
+                . "  end\n"
+                . "  return {0, limit - count, math.ceil(retry)}\n"
+                . "end\n"
+                . "for i = 1, cost do\n"
+                . "  redis.call('ZADD', KEYS[1], now, ARGV[4] .. ':' .. i)\n"
+                . "end\n"
+                . "redis.call('PEXPIRE', KEYS[1], math.ceil(period / 1000))\n"
+                . "return {1, limit - count - cost, 0}";
+        } else {
+            let script = "local t = redis.call('TIME')\n"
+                . "local now = tonumber(t[1]) * 1000000 + tonumber(t[2])\n"
+                . "local period = tonumber(ARGV[1])\n"
+                . "local limit = tonumber(ARGV[2])\n"
+                . "local cost = tonumber(ARGV[3])\n"
+                . "local emission = period / limit\n"
+                . "local tat = now\n"
+                . "local stored = redis.call('GET', KEYS[1])\n"
+                . "if stored then tat = math.max(tonumber(stored), now) end\n"
+                . "local newTat = tat + cost * emission\n"
+                . "local allowAt = newTat - period\n"
+                . "if now < allowAt then\n"
+                . "  return {0, math.floor((now + period - tat) / emission), math.ceil(allowAt - now)}\n"
+                . "end\n"
+                . "redis.call('SET', KEYS[1], string.format('%d', math.floor(newTat)), 'PX', math.ceil((newTat - now) / 1000) + 1)\n"
+                . "return {1, math.floor((now - allowAt) / emission), 0}";
+        }
+
+        /**
+         * The arguments of the script must reach Redis as plain numbers
+         */
+        let serializer = connection->getOption(\Redis::OPT_SERIALIZER);
+        if serializer != \Redis::SERIALIZER_NONE {
+            connection->setOption(\Redis::OPT_SERIALIZER, \Redis::SERIALIZER_NONE);
+        }
+
+        let result = connection->eval(
+            script,
+            [
+                key,
+                this->interval * 1000000,
+                this->limit,
+                tokens,
+                uniqid("", true)
+            ],
+            1
+        );
+
+        if serializer != \Redis::SERIALIZER_NONE {
+            connection->setOption(\Redis::OPT_SERIALIZER, serializer);
+        }
+
+        if unlikely typeof result !== "array" {
+            throw new Exception(
+                "Cannot update the rate limiter state for " . key
+            );
+        }
+
+        return [
+            1 == result[0],
+            (int) result[1],
+            (int) result[2]
+        ];
+    }
+
+    /**
+     * Seconds to keep the state in the backend
+     *
+     * @return int
+     */
+    protected function getTtl() -> int
+    {
+        return this->interval + 1;
+    }
+
+    /**
+     * Applies the algorithm to the stored state. Returns
+     * `[allowed, remaining, retryAfter, newState]`
+     *
+     * @param mixed $stored
+     * @param int   $tokens
+     *
+     * @return array
+     */
+    protected function process(var stored, int tokens) -> array
+    {
+        var allowAt, emission, entries, entry, newTat, now, period, retry, tat;
+        int count, counter;
+        array valid = [];
+
+        let now    = (int) (microtime(true) * 1000000),
+            period = this->interval * 1000000;
+
+        if this->algorithm === self::SLIDING_WINDOW {
+            let entries = [];
+            if typeof stored === "string" && stored !== "" {
+                let entries = explode(",", stored);
+            }
+
+            for entry in entries {
+                if (int) entry > now - period {
+                    let valid[] = (int) entry;
+                }
+            }
+
+            let count = count(valid);
+
+            if count + tokens > this->limit {
+                let retry = period;
+                if tokens <= this->limit {
+                    let retry = valid[count + tokens - this->limit - 1] + period - now;
+                }
+
+                return [false, this->limit - count, retry, stored];
+            }
+
+            let counter = 0;
+            while counter < tokens {
+                let valid[] = now,
+                    counter++;
+            }
+
+            return [true, this->limit - count - tokens, 0, implode(",", valid)];
+        }
+
+        let emission = period / this->limit,
+            tat      = now;
+
+        if is_numeric(stored) {
+            let tat = max((int) stored, now);
+        }
+
+        let newTat  = tat + tokens * emission,
+            allowAt = newTat - period;
+
+        if now < allowAt {
+            return [
+                false,
+                (int) floor((now + period - tat) / emission),
+                (int) ceil(allowAt - now),
+                stored
+            ];
+        }
+
+        return [
+            true,
+            (int) floor((now - allowAt) / emission),
+            0,
+            (int) floor(newTat)
+        ];
+    }
+}
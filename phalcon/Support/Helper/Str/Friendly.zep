@@ -39,6 +39,15 @@ class Friendly extends AbstractStr
         if replace {
             let replace = this->checkReplace(replace);
         } else {
+            /**
+             * Without custom replacements the text is transliterated,
+             * filtered and separated natively in one pass
+             */
+            let friendly = phalcon_str_friendly(text, separator, lowercase);
+            if likely typeof friendly === "string" {
+                return friendly;
+            }
+
             let replace = [];
         }
 
@@ -27,6 +27,11 @@ class KebabCase extends PascalCase
     ) -> string {
         var output;
 
+        let output = phalcon_str_delimit(text, delimiters, "-");
+        if likely typeof output === "string" {
+            return output;
+        }
+
         let output = this->processArray(text, delimiters);
 
         return implode("-", output);
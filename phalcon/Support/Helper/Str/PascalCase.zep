@@ -27,6 +27,14 @@ class PascalCase
     ) -> string {
         var exploded, output, element;
 
+        /**
+         * ASCII text is converted natively in one pass
+         */
+        let output = phalcon_str_camelize(text, delimiters, true);
+        if likely typeof output === "string" {
+            return output;
+        }
+
         let exploded = this->processArray(text, delimiters);
 
         let output = "";
@@ -22,10 +22,9 @@ class ReduceSlashes
      */
     public function __invoke(string text) -> string
     {
-        var result;
-
-        let result = preg_replace("#(?<!:)//+#", "/", text);
-
-        return (null === result) ? "" : result;
+        /**
+         * Same as preg_replace("#(?<!:)//+#", "/", text)
+         */
+        return phalcon_str_reduce_slashes(text);
     }
 }
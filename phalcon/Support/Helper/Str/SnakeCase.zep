@@ -27,6 +27,11 @@ class SnakeCase extends PascalCase
     ) -> string {
         var output;
 
+        let output = phalcon_str_delimit(text, delimiters, "_");
+        if likely typeof output === "string" {
+            return output;
+        }
+
         let output = this->processArray(text, delimiters);
 
         return implode("_", output);
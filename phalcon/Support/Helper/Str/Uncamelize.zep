@@ -25,6 +25,16 @@ class Uncamelize
         string text,
         string delimiter = "_"
     ) -> string {
+        var result;
+
+        /**
+         * ASCII text is converted natively in one pass
+         */
+        let result = phalcon_str_uncamelize(text, delimiter);
+        if likely typeof result === "string" {
+            return result;
+        }
+
         return mb_strtolower(
             preg_replace(
                 "/[A-Z]/",
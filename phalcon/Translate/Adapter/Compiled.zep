@@ -0,0 +1,234 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Translate\Adapter;
+
+use ArrayAccess;
+use Phalcon\Translate\Compiler;
+use Phalcon\Translate\Exception;
+use Phalcon\Translate\InterpolatorFactory;
+
+/**
+ * Phalcon\Translate\Adapter\Compiled
+ *
+ * Reads a catalog compiled by `Phalcon\Translate\Compiler`. The messages are
+ * already split in segments, so the `%placeholder%` values of the default
+ * `associativeArray` interpolator are joined without searching the message.
+ *
+ * When `sources` are passed, the catalog is compiled again if it is older
+ * than one of their files.
+ *
+ * ```php
+ * use Phalcon\Translate\Adapter\Compiled;
+ * use Phalcon\Translate\InterpolatorFactory;
+ *
+ * $adapter = new Compiled(
+ *     new InterpolatorFactory(),
+ *     [
+ *         "content" => "/app/cache/translations/de_AT.php",
+ *         "sources" => [
+ *             [
+ *                 "adapter" => "csv",
+ *                 "content" => "/app/locales/de_AT.csv",
+ *             ],
+ *             [
+ *                 "adapter" => "csv",
+ *                 "content" => "/app/locales/de_DE.csv",
+ *             ],
+ *         ],
+ *     ]
+ * );
+ * ```
+ *
+ * @property array $translate
+ * @property bool  $triggerError
+ */
+class Compiled extends AbstractAdapter implements ArrayAccess
+{
+    /**
+     * @var array
+     */
+    protected translate = [];
+
+    /**
+     * @var bool
+     */
+    protected triggerError = false;
+
+    /**
+     * Compiled constructor.
+     *
+     * @param InterpolatorFactory $interpolator
+     * @param array               $options = [
+     *                                'content'      => '',
+     *                                'sources'      => [],
+     *                                'triggerError' => false
+     *                            ]
+     *
+     * @throws Exception
+     */
+    public function __construct(<InterpolatorFactory> interpolator, array! options)
+    {
+        var compiler, data, error, file, sources;
+
+        parent::__construct(interpolator, options);
+
+        if unlikely !fetch file, options["content"] {
+            throw new Exception("Parameter 'content' is required");
+        }
+
+        if fetch error, options["triggerError"] {
+            let this->triggerError = (bool) error;
+        }
+
+        if fetch sources, options["sources"] {
+            let compiler = new Compiler();
+
+            if compiler->isStale(sources, file) {
+                compiler->compile(sources, file);
+            }
+        }
+
+        if unlikely !file_exists(file) {
+            throw new Exception(
+                "Error opening translation file '" . file . "'"
+            );
+        }
+
+        let data = require file;
+
+        if unlikely typeof data !== "array" {
+            throw new Exception("Translation data must be an array");
+        }
+
+        let this->translate = data;
+    }
+
+    /**
+     * Check whether is defined a translation key in the internal array
+     *
+     * @param string $index
+     *
+     * @return bool
+     */
+    public function has(string! index) -> bool
+    {
+        return isset this->translate[index];
+    }
+
+    /**
+     * Whenever a key is not found this method will be called
+     *
+     * @param string $index
+     *
+     * @return string
+     * @throws Exception
+     */
+    public function notFound(string! index) -> string
+    {
+        if unlikely (true === this->triggerError) {
+            throw new Exception("Cannot find translation key: " . index);
+        }
+
+        return index;
+    }
+
+    /**
+     * Returns the translation related to the given key
+     *
+     * @param string $translateKey
+     * @param array  $placeholders
+     *
+     * @return string
+     * @throws Exception
+     */
+    public function query(string! translateKey, array placeholders = []) -> string
+    {
+        var position, segment, segments, value;
+        string translation;
+
+        if !fetch segments, this->translate[translateKey] {
+            return this->notFound(translateKey);
+        }
+
+        if this->defaultInterpolator !== "associativeArray" {
+            return this->replacePlaceholders(
+                this->join(segments),
+                placeholders
+            );
+        }
+
+        if typeof segments !== "array" {
+            return segments;
+        }
+
+        let translation = "";
+
+        for position, segment in segments {
+            if position % 2 === 0 {
+                let translation .= segment;
+            } elseif fetch value, placeholders[segment] {
+                let translation .= value;
+            } else {
+                let translation .= "%" . segment . "%";
+            }
+        }
+
+        return translation;
+    }
+
+    /**
+     * Returns the internal array
+     *
+     * @return array
+     */
+    public function toArray() -> array
+    {
+        var key, segments;
+        array translations;
+
+        let translations = [];
+
+        for key, segments in this->translate {
+            let translations[key] = this->join(segments);
+        }
+
+        return translations;
+    }
+
+    /**
+     * Returns the message of the segments
+     *
+     * @param array|string $segments
+     *
+     * @return string
+     */
+    protected function join(var segments) -> string
+    {
+        var position, segment;
+        string message;
+
+        if typeof segments !== "array" {
+            return segments;
+        }
+
+        let message = "";
+
+        for position, segment in segments {
+            if position % 2 === 0 {
+                let message .= segment;
+            } else {
+                let message .= "%" . segment . "%";
+            }
+        }
+
+        return message;
+    }
+}
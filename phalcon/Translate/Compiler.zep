@@ -0,0 +1,291 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Translate;
+
+use Phalcon\Translate\Adapter\Csv;
+
+/**
+ * Phalcon\Translate\Compiler
+ *
+ * Compiles CSV, gettext (.mo) and array sources into a PHP file that returns
+ * the catalog as an array literal. Included files are kept in opcache, so the
+ * catalog is neither parsed nor built on every request.
+ *
+ * The sources are a fallback chain: the first one is the locale and the
+ * following ones fill in the keys that it does not translate. Every message
+ * is split in literal and `%placeholder%` segments, which are read by
+ * `Phalcon\Translate\Adapter\Compiled`.
+ *
+ * ```php
+ * use Phalcon\Translate\Compiler;
+ *
+ * $compiler = new Compiler();
+ *
+ * $compiler->compile(
+ *     [
+ *         [
+ *             "adapter" => "csv",
+ *             "content" => "/app/locales/de_AT.csv",
+ *         ],
+ *         [
+ *             "adapter" => "gettext",
+ *             "content" => "/app/locales/de_DE/LC_MESSAGES/messages.mo",
+ *         ],
+ *         [
+ *             "adapter" => "array",
+ *             "content" => [
+ *                 "hello" => "Hello %name%",
+ *             ],
+ *         ],
+ *     ],
+ *     "/app/cache/translations/de_AT.php"
+ * );
+ * ```
+ */
+class Compiler
+{
+    /**
+     * Compiles the sources into `target` and returns the number of messages
+     *
+     * @param array  $sources
+     * @param string $target
+     *
+     * @return int
+     * @throws Exception
+     */
+    public function compile(array! sources, string! target) -> int
+    {
+        var key, message, messages, source, temporary;
+
+        let messages = [];
+
+        for source in sources {
+            if unlikely typeof source !== "array" {
+                throw new Exception("A catalog source must be an array");
+            }
+
+            for key, message in this->read(source) {
+                if !isset messages[key] {
+                    let messages[key] = this->split((string) message);
+                }
+            }
+        }
+
+        /**
+         * Write a temporary file and rename it, so that a request never
+         * includes a partial catalog
+         */
+        let temporary = target . "." . uniqid() . ".tmp";
+
+        if unlikely file_put_contents(
+            temporary,
+            "<?php\n\nreturn " . var_export(messages, true) . ";\n"
+        ) === false {
+            throw new Exception(
+                "The catalog file '" . target . "' cannot be written"
+            );
+        }
+
+        if unlikely !rename(temporary, target) {
+            unlink(temporary);
+
+            throw new Exception(
+                "The catalog file '" . target . "' cannot be written"
+            );
+        }
+
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(target, true);
+        }
+
+        return count(messages);
+    }
+
+    /**
+     * Checks if the catalog `target` is older than one of the files in the
+     * sources
+     *
+     * @param array  $sources
+     * @param string $target
+     *
+     * @return bool
+     */
+    public function isStale(array! sources, string! target) -> bool
+    {
+        var compiled, content, source;
+
+        if !file_exists(target) {
+            return true;
+        }
+
+        let compiled = filemtime(target);
+
+        for source in sources {
+            if fetch content, source["content"] {
+                if typeof content === "string" && filemtime(content) > compiled {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Splits a message in literal segments, at the even positions, and
+     * placeholder names, at the odd positions. Messages without
+     * placeholders are returned as they are
+     *
+     * @param string $message
+     *
+     * @return array|string
+     */
+    public function split(string! message) -> array | string
+    {
+        var segments;
+
+        if !memstr(message, "%") {
+            return message;
+        }
+
+        let segments = preg_split(
+            "/%([^%\\s]+)%/",
+            message,
+            -1,
+            PREG_SPLIT_DELIM_CAPTURE
+        );
+
+        if count(segments) === 1 {
+            return message;
+        }
+
+        return segments;
+    }
+
+    /**
+     * Returns the messages of a source
+     *
+     * @param array $source
+     *
+     * @return array
+     * @throws Exception
+     */
+    protected function read(array source) -> array
+    {
+        var adapter, content, csv;
+
+        if unlikely !fetch adapter, source["adapter"] {
+            throw new Exception("Parameter 'adapter' is required");
+        }
+
+        if unlikely !fetch content, source["content"] {
+            throw new Exception("Parameter 'content' is required");
+        }
+
+        switch adapter {
+            case "array":
+                if unlikely typeof content !== "array" {
+                    throw new Exception("Translation data must be an array");
+                }
+
+                return content;
+
+            case "csv":
+                let csv = new Csv(new InterpolatorFactory(), source);
+
+                return csv->toArray();
+
+            case "gettext":
+                return this->readMo(content);
+        }
+
+        throw new Exception(
+            "The adapter '" . adapter . "' cannot be compiled"
+        );
+    }
+
+    /**
+     * Returns the messages of a gettext .mo file. Only the singular form of
+     * plural messages is kept
+     *
+     * @param string $file
+     *
+     * @return array
+     * @throws Exception
+     */
+    protected function readMo(string file) -> array
+    {
+        var data, format, header, magic, messages, nul, original, position,
+            translation;
+        int counter;
+
+        let data = file_exists(file) ? file_get_contents(file) : false;
+
+        if unlikely (data === false || strlen(data) < 28) {
+            throw new Exception(
+                "Error opening translation file '" . file . "'"
+            );
+        }
+
+        let magic = unpack("Vmagic", substr(data, 0, 4));
+
+        if magic["magic"] == 0x950412de {
+            let format = "V";
+        } elseif magic["magic"] == 0xde120495 {
+            let format = "N";
+        } else {
+            throw new Exception(
+                "The file '" . file . "' is not a gettext catalog"
+            );
+        }
+
+        let header   = unpack(
+                format . "revision/" . format . "count/" . format . "originals/" . format . "translations",
+                substr(data, 4, 16)
+            ),
+            messages = [],
+            nul      = chr(0),
+            counter  = 0;
+
+        while counter < header["count"] {
+            let position = unpack(
+                format . "length/" . format . "offset",
+                substr(data, header["originals"] + counter * 8, 8)
+            );
+
+            let original = substr(data, position["offset"], position["length"]);
+
+            let position = unpack(
+                format . "length/" . format . "offset",
+                substr(data, header["translations"] + counter * 8, 8)
+            );
+
+            let translation = substr(data, position["offset"], position["length"]),
+                counter++;
+
+            /**
+             * The empty message is the header of the catalog
+             */
+            if original === "" {
+                continue;
+            }
+
+            if memstr(original, nul) {
+                let original    = strstr(original, nul, true),
+                    translation = strstr(translation . nul, nul, true);
+            }
+
+            let messages[original] = translation;
+        }
+
+        return messages;
+    }
+}
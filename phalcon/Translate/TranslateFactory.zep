@@ -118,9 +118,10 @@ class TranslateFactory extends AbstractFactory
     protected function getServices() -> array
     {
         return [
-            "csv"     : "Phalcon\\Translate\\Adapter\\Csv",
-            "gettext" : "Phalcon\\Translate\\Adapter\\Gettext",
-            "array"   : "Phalcon\\Translate\\Adapter\\NativeArray"
+            "csv"      : "Phalcon\\Translate\\Adapter\\Csv",
+            "gettext"  : "Phalcon\\Translate\\Adapter\\Gettext",
+            "array"    : "Phalcon\\Translate\\Adapter\\NativeArray",
+            "compiled" : "Phalcon\\Translate\\Adapter\\Compiled"
         ];
     }
 }
@@ -0,0 +1,146 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\DataMapper\Pdo\Connection;
+
+use DatabaseTester;
+use Phalcon\DataMapper\Pdo\Connection;
+use Phalcon\DataMapper\Pdo\Connection\BatchIterator;
+use Phalcon\DataMapper\Pdo\Exception\Exception;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+
+class YieldAllCest
+{
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\Connection :: yieldAll()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dMPdoConnectionYieldAll(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\Connection - yieldAll()');
+
+        /** @var Connection $connection */
+        $connection = $I->getDataMapperConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+
+        for ($id = 1; $id <= 5; $id++) {
+            $I->assertEquals(1, $migration->insert($id));
+        }
+
+        $rows = $connection->yieldAll(
+            'SELECT * from co_invoices WHERE inv_id > :id ORDER BY inv_id',
+            [
+                'id' => 1,
+            ],
+            2
+        );
+        $I->assertInstanceOf(BatchIterator::class, $rows);
+
+        $ids = [];
+        foreach ($rows as $key => $row) {
+            $ids[$key] = (int) $row['inv_id'];
+        }
+        $I->assertSame([2, 3, 4, 5], $ids);
+
+        $I->expectThrowable(
+            new Exception('The rows of a statement can be traversed only once'),
+            function () use ($rows) {
+                foreach ($rows as $row) {
+                }
+            }
+        );
+    }
+
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\Connection ::
+     * setStatementCacheSize()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dMPdoConnectionSetStatementCacheSize(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\Connection - setStatementCacheSize()');
+
+        /** @var Connection $connection */
+        $connection = $I->getDataMapperConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+
+        $migration->insert(1);
+        $migration->insert(2);
+
+        $I->assertSame(0, $connection->getStatementCacheSize());
+
+        $sql = 'SELECT inv_id from co_invoices WHERE inv_id = :id';
+        $I->assertNotSame(
+            $connection->perform($sql, ['id' => 1]),
+            $connection->perform($sql, ['id' => 1])
+        );
+
+        $connection->setStatementCacheSize(2);
+        $I->assertSame(2, $connection->getStatementCacheSize());
+
+        $first = $connection->perform($sql, ['id' => 1]);
+        $I->assertSame($first, $connection->perform($sql, ['id' => 2]));
+        $I->assertEquals(2, $connection->fetchValue($sql, ['id' => 2]));
+        $I->assertEquals(1, $connection->fetchValue($sql, ['id' => 1]));
+
+        /**
+         * The least recently used statement is removed
+         */
+        $connection->perform('SELECT 1');
+        $connection->perform('SELECT 2');
+        $I->assertNotSame($first, $connection->perform($sql, ['id' => 1]));
+
+        $connection->clearStatements();
+        $connection->setStatementCacheSize(0);
+    }
+
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\Connection :: fetchAll() -
+     * profiler phases
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dMPdoConnectionFetchAllProfilerPhases(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\Connection - fetchAll() - profiler phases');
+
+        /** @var Connection $connection */
+        $connection = $I->getDataMapperConnection();
+        $migration  = new InvoicesMigration($connection);
+        $migration->clear();
+
+        $migration->insert(1);
+
+        $connection->getProfiler()
+                   ->setActive(true)
+                   ->setLogFormat('{method} {prepare} {execute} {fetch}')
+        ;
+
+        $connection->fetchAll('SELECT * from co_invoices');
+
+        $messages = $connection->getProfiler()->getLogger()->getMessages();
+        $parts    = explode(' ', end($messages));
+
+        $I->assertSame('perform', $parts[0]);
+        $I->assertGreaterThan(0, (int) $parts[1]);
+        $I->assertGreaterThan(0, (int) $parts[2]);
+        $I->assertGreaterThan(0, (int) $parts[3]);
+
+        $connection->getProfiler()->setActive(false);
+    }
+}
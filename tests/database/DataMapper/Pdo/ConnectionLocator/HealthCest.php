@@ -0,0 +1,166 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\DataMapper\Pdo\ConnectionLocator;
+
+use DatabaseTester;
+use Phalcon\DataMapper\Pdo\Connection;
+use Phalcon\DataMapper\Pdo\ConnectionLocator;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+
+use function spl_object_hash;
+
+class HealthCest
+{
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\ConnectionLocator :: getRead() -
+     * weights and failed connections
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dMPdoConnectionLocatorGetReadFailed(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\ConnectionLocator - getRead() - failed');
+
+        $master  = $I->getDataMapperConnection();
+        $read1   = $I->getDataMapperConnection();
+        $read2   = $I->getDataMapperConnection();
+        $dead    = new Connection('sqlite:/path/does/not/exist/phalcon.sqlite');
+        $locator = new ConnectionLocator($master);
+
+        $locator
+            ->setRead(
+                'read1',
+                function () use ($read1) {
+                    return $read1;
+                },
+                0
+            )
+            ->setRead(
+                'read2',
+                function () use ($read2) {
+                    return $read2;
+                }
+            )
+            ->setRead(
+                'dead',
+                function () use ($dead) {
+                    return $dead;
+                },
+                100
+            )
+            ->setBackoff(60.0)
+        ;
+
+        for ($counter = 0; $counter < 10; $counter++) {
+            $I->assertSame(
+                spl_object_hash($read2),
+                spl_object_hash($locator->getRead())
+            );
+        }
+
+        /**
+         * Named connections are always returned
+         */
+        $I->assertSame($read1, $locator->getRead('read1'));
+        $I->assertSame($dead, $locator->getRead('dead'));
+
+        /**
+         * Nothing available returns the master
+         */
+        $locator->markFailed('read', 'read2');
+        $I->assertSame($master, $locator->getRead());
+    }
+
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\ConnectionLocator ::
+     * setLagProbe()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dMPdoConnectionLocatorSetLagProbe(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\ConnectionLocator - setLagProbe()');
+
+        $master  = $I->getDataMapperConnection();
+        $read1   = $I->getDataMapperConnection();
+        $read2   = $I->getDataMapperConnection();
+        $locator = new ConnectionLocator(
+            $master,
+            [
+                'read1' => function () use ($read1) {
+                    return $read1;
+                },
+                'read2' => function () use ($read2) {
+                    return $read2;
+                },
+            ]
+        );
+
+        $locator->setLagProbe(
+            function ($connection) use ($read1) {
+                return $connection === $read1 ? 5.0 : 0.1;
+            },
+            2.0,
+            60.0
+        );
+
+        for ($counter = 0; $counter < 10; $counter++) {
+            $I->assertSame($read2, $locator->getRead());
+        }
+    }
+
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\ConnectionLocator :: setSticky()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dMPdoConnectionLocatorSetSticky(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\ConnectionLocator - setSticky()');
+
+        $master  = $I->getDataMapperConnection();
+        $read1   = $I->getDataMapperConnection();
+        $locator = new ConnectionLocator(
+            $master,
+            [
+                'read1' => function () use ($read1) {
+                    return $read1;
+                },
+            ]
+        );
+
+        (new InvoicesMigration($master))->clear();
+
+        $locator->setSticky();
+
+        $locator->getWrite()->fetchAll('SELECT * FROM co_invoices');
+        $I->assertFalse($locator->isPinned());
+        $I->assertSame($read1, $locator->getRead());
+
+        $locator->getWrite()->perform(
+            'UPDATE co_invoices SET inv_title = :title WHERE inv_id = 0',
+            [
+                'title' => 'sticky',
+            ]
+        );
+        $I->assertTrue($locator->isPinned());
+        $I->assertSame($master, $locator->getRead());
+        $I->assertSame($read1, $locator->getRead('read1'));
+
+        $locator->unpin();
+        $I->assertFalse($locator->isPinned());
+        $I->assertSame($read1, $locator->getRead());
+    }
+}
@@ -15,6 +15,7 @@ namespace Phalcon\Tests\Database\Filter\Validation\Validator;
 
 use DatabaseTester;
 use PDO;
+use Phalcon\Events\Manager as EventsManager;
 use Phalcon\Tests\Fixtures\Migrations\ObjectsMigration;
 use Phalcon\Tests\Fixtures\Traits\DiTrait;
 use Phalcon\Tests\Models\Objects;
@@ -580,4 +581,284 @@ class UniquenessCest
             $messages->count()
         );
     }
+
+    /**
+     * Filter\Validation\Validator\Uniqueness with validateBatch()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function filterValidationValidatorUniquenessBatch(DatabaseTester $I)
+    {
+        $I->wantToTest('Filter\Validation\Validator\Uniqueness with validateBatch()');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration = new ObjectsMigration($connection);
+        $migration->insert(1, 'Phalcon 1', 1);
+        $migration->insert(2, 'Phalcon 2', 2);
+
+        $validation = new Validation();
+
+        $validation->add(
+            'obj_name',
+            new Uniqueness(
+                [
+                    'model'     => new Objects(),
+                    'batchSize' => 2,
+                ]
+            )
+        );
+
+        $rows = [
+            'a' => ['obj_name' => 'Phalcon 1'],
+            'b' => ['obj_name' => 'Not Phalcon'],
+            'c' => ['obj_name' => 'Phalcon 2'],
+        ];
+
+        $results = $validation->validateBatch($rows);
+
+        $I->assertSame(['a', 'b', 'c'], array_keys($results));
+        $I->assertEquals(1, $results['a']->count());
+        $I->assertEquals(0, $results['b']->count());
+        $I->assertEquals(1, $results['c']->count());
+
+        $I->assertEquals(
+            'Field obj_name must be unique',
+            $results['c'][0]->getMessage()
+        );
+
+        /**
+         * Combination of fields
+         */
+        $validation = new Validation();
+
+        $validation->add(
+            ['obj_name', 'obj_type'],
+            new Uniqueness(
+                [
+                    'model' => new Objects(),
+                ]
+            )
+        );
+
+        $rows = [
+            ['obj_name' => 'Phalcon 1', 'obj_type' => 1],
+            ['obj_name' => 'Phalcon 1', 'obj_type' => 2],
+            ['obj_name' => 'Phalcon 2', 'obj_type' => 2],
+        ];
+
+        $results = $validation->validateBatch($rows);
+
+        $I->assertEquals(1, $results[0]->count());
+        $I->assertEquals(0, $results[1]->count());
+        $I->assertEquals(1, $results[2]->count());
+
+        /**
+         * The values are read from the rows, the entity is the model
+         */
+        $validation = new Validation();
+
+        $validation->add(
+            'obj_name',
+            new Uniqueness()
+        );
+
+        $rows = [
+            ['obj_name' => 'Phalcon 2'],
+            ['obj_name' => 'Not Phalcon'],
+        ];
+
+        $results = $validation->validateBatch($rows, Objects::findFirst(1));
+
+        $I->assertEquals(1, $results[0]->count());
+        $I->assertEquals(0, $results[1]->count());
+    }
+
+    /**
+     * Tests Phalcon\Filter\Validation\Validator\Uniqueness :: validateBatch()
+     * with values equal only in the collation of the database
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     *
+     * @group  mysql
+     */
+    public function filterValidationValidatorUniquenessBatchCollation(DatabaseTester $I)
+    {
+        $I->wantToTest('Filter\Validation\Validator\Uniqueness with validateBatch() - collation');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration = new ObjectsMigration($connection);
+        $migration->insert(1, 'Phalcon 1', 1);
+
+        $validation = new Validation();
+
+        $validation->add(
+            'obj_name',
+            new Uniqueness(
+                [
+                    'model' => new Objects(),
+                ]
+            )
+        );
+
+        $rows = [
+            ['obj_name' => 'Phalcon 1'],
+            ['obj_name' => 'PHALCON 1'],
+            ['obj_name' => 'Phalcon 1 '],
+            ['obj_name' => 'Not Phalcon'],
+        ];
+
+        $results = $validation->validateBatch($rows);
+
+        /**
+         * The same results as validate() for each row
+         */
+        foreach ($rows as $key => $row) {
+            $I->assertEquals(
+                $validation->validate($row)->count(),
+                $results[$key]->count()
+            );
+        }
+
+        $I->assertEquals(1, $results[1]->count());
+        $I->assertEquals(0, $results[3]->count());
+    }
+
+    /**
+     * Tests Phalcon\Filter\Validation\Validator\Uniqueness :: validateBatch()
+     * - number of queries
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function filterValidationValidatorUniquenessBatchQueries(DatabaseTester $I)
+    {
+        $I->wantToTest('Filter\Validation\Validator\Uniqueness with validateBatch() - queries');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration = new ObjectsMigration($connection);
+        $migration->insert(1, 'Phalcon 1', 1);
+
+        $validation = new Validation();
+
+        $validation->add(
+            'obj_name',
+            new Uniqueness(
+                [
+                    'model' => new Objects(),
+                ]
+            )
+        );
+
+        $rows = [
+            ['obj_name' => 'Phalcon 1'],
+        ];
+        for ($index = 0; $index < 50; $index++) {
+            $rows[] = ['obj_name' => 'Other ' . $index];
+        }
+
+        /**
+         * Loads the metadata before counting
+         */
+        $validation->validateBatch($rows);
+
+        $queries       = 0;
+        $eventsManager = new EventsManager();
+        $eventsManager->attach(
+            'db:beforeQuery',
+            function () use (&$queries) {
+                $queries++;
+            }
+        );
+
+        $db = $this->container->getShared('db');
+        $db->setEventsManager($eventsManager);
+
+        /**
+         * One duplicate costs the query of the chunk only
+         */
+        $results = $validation->validateBatch($rows);
+
+        $I->assertSame(1, $queries);
+        $I->assertEquals(1, $results[0]->count());
+        $I->assertEquals(0, $results[1]->count());
+
+        /**
+         * A row equal to the duplicate once case folded is counted
+         */
+        $queries = 0;
+        $rows[]  = ['obj_name' => 'PHALCON 1'];
+        $validation->validateBatch($rows);
+
+        $I->assertSame(2, $queries);
+    }
+
+    /**
+     * Tests Phalcon\Filter\Validation\Validator\Uniqueness :: validateBatch()
+     * with the primary key of each row
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function filterValidationValidatorUniquenessBatchPrimaryKey(DatabaseTester $I)
+    {
+        $I->wantToTest('Filter\Validation\Validator\Uniqueness with validateBatch() - primary key');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration = new ObjectsMigration($connection);
+        $migration->insert(1, 'Phalcon 1', 1);
+        $migration->insert(2, 'Phalcon 2', 2);
+
+        $validation = new Validation();
+
+        $validation->add(
+            'obj_name',
+            new Uniqueness(
+                [
+                    'primaryKey' => 'obj_id',
+                ]
+            )
+        );
+        $validation->setFilters('obj_name', 'trim');
+
+        $rows = [
+            'own'      => ['obj_id' => 1, 'obj_name' => 'Phalcon 1'],
+            'other'    => ['obj_id' => 1, 'obj_name' => 'Phalcon 2'],
+            'new'      => ['obj_name' => 'Phalcon 1'],
+            'filtered' => ['obj_id' => 2, 'obj_name' => ' PHALCON 2 '],
+        ];
+
+        $entity  = Objects::findFirst(1);
+        $results = $validation->validateBatch($rows, $entity);
+
+        /**
+         * Each row excludes its own record, not the one of the entity
+         */
+        $I->assertEquals(0, $results['own']->count());
+        $I->assertEquals(1, $results['other']->count());
+        $I->assertEquals(1, $results['new']->count());
+        $I->assertEquals(0, $results['filtered']->count());
+
+        /**
+         * The filtered values of the rows are not written to the entity
+         */
+        $I->assertSame('Phalcon 1', $entity->obj_name);
+    }
 }
@@ -18,6 +18,7 @@ use PDO;
 use Phalcon\Cache\AdapterFactory;
 use Phalcon\Cache\Cache;
 use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Resultset\Simple;
 use Phalcon\Mvc\Router;
 use Phalcon\Storage\SerializerFactory;
 use Phalcon\Tests\Fixtures\Migrations\CustomersMigration;
@@ -28,6 +29,7 @@ use Phalcon\Tests\Models\Customers;
 use Phalcon\Tests\Models\Invoices;
 use Phalcon\Tests\Models\Objects;
 
+use function array_column;
 use function getOptionsRedis;
 use function ob_end_clean;
 use function ob_end_flush;
@@ -35,6 +37,7 @@ use function ob_get_contents;
 use function ob_start;
 use function outputDir;
 use function sleep;
+use function sort;
 use function uniqid;
 use function var_dump;
 
@@ -538,4 +541,99 @@ class FindCest
         $expected = 'Use of "static" in callables in deprecated';
         $I->assertStringNotContainsString($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: find() - with
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelFindEagerLoading(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - find() - with');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+
+        $customersMigration = new CustomersMigration($connection);
+        $customersMigration->insert(1, 1, 'first', 'customer');
+        $customersMigration->insert(2, 1, 'second', 'customer');
+        $customersMigration->insert(3, 1, 'third', 'customer');
+
+        $invoicesMigration = new InvoicesMigration($connection);
+        $invoicesMigration->insert(10, 1, Invoices::STATUS_PAID, 'inv-10');
+        $invoicesMigration->insert(11, 1, Invoices::STATUS_UNPAID, 'inv-11');
+        $invoicesMigration->insert(12, 2, Invoices::STATUS_UNPAID, 'inv-12');
+
+        $customers = Customers::find(
+            [
+                'order' => 'cst_id',
+                'with'  => ['invoices', 'paidInvoices', 'invoices.customer'],
+            ]
+        );
+
+        /**
+         * The related records are already loaded, removing them from the
+         * database does not change the result
+         */
+        $connection->exec('DELETE FROM co_invoices');
+
+        $I->assertCount(3, $customers);
+
+        $customer = $customers[0];
+        $I->assertTrue($customer->isRelationshipLoaded('invoices'));
+        $I->assertInstanceOf(Simple::class, $customer->invoices);
+        $I->assertCount(2, $customer->invoices);
+        $I->assertInstanceOf(Invoices::class, $customer->invoices[0]);
+        $I->assertInstanceOf(Invoices::class, $customer->invoices->getFirst());
+
+        $ids = array_column($customer->invoices->toArray(), 'inv_id');
+        sort($ids);
+        $I->assertEquals([10, 11], $ids);
+
+        $I->assertCount(1, $customer->paidInvoices);
+        $I->assertEquals(10, $customer->paidInvoices[0]->inv_id);
+
+        /**
+         * Nested relation
+         */
+        $invoice = $customer->invoices[0];
+        $I->assertTrue($invoice->isRelationshipLoaded('customer'));
+        $I->assertEquals(1, $invoice->customer->cst_id);
+
+        $customer = $customers[1];
+        $I->assertCount(1, $customer->getRelated('invoices'));
+        $I->assertCount(0, $customer->paidInvoices);
+
+        $customer = $customers[2];
+        $I->assertTrue($customer->isRelationshipLoaded('invoices'));
+        $I->assertInstanceOf(Simple::class, $customer->invoices);
+        $I->assertCount(0, $customer->invoices);
+        $I->assertSame([], $customer->invoices->toArray());
+        $I->assertNull($customer->invoices->getFirst());
+
+        /**
+         * Builder
+         */
+        $invoicesMigration->insert(13, 3, Invoices::STATUS_PAID, 'inv-13');
+
+        $builder = $this->container->get('modelsManager')
+            ->createBuilder()
+            ->from(Invoices::class)
+            ->with('customer')
+        ;
+
+        $I->assertSame(['customer'], $builder->getWith());
+
+        $invoices = $builder->getQuery()->execute();
+
+        $connection->exec('DELETE FROM co_customers');
+
+        $invoice = $invoices->getFirst();
+        $I->assertEquals(3, $invoice->customer->cst_id);
+    }
 }
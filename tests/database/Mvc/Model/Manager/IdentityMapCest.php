@@ -0,0 +1,168 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Manager;
+
+use DatabaseTester;
+use Phalcon\Storage\Exception;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+
+class IdentityMapCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param  DatabaseTester $I
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useIdentityMap()
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerUseIdentityMap(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useIdentityMap()');
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->insert(1, 1, 0, 'first');
+        $migration->insert(2, 1, 0, 'second');
+
+        $manager = $this->container->getShared('modelsManager');
+
+        /**
+         * Disabled
+         */
+        $I->assertFalse($manager->isUsingIdentityMap());
+        $I->assertNotSame(Invoices::findFirst(1), Invoices::findFirst(1));
+
+        $manager->useIdentityMap();
+        $I->assertTrue($manager->isUsingIdentityMap());
+
+        /**
+         * Lookups by primary key and hydration
+         */
+        $invoice = Invoices::findFirst(1);
+        $I->assertSame($invoice, $manager->getIdentity(Invoices::class, 1));
+        $I->assertSame($invoice, Invoices::findFirst(1));
+        $I->assertSame($invoice, Invoices::findFirst('1'));
+        $I->assertSame(
+            $invoice,
+            Invoices::findFirst(
+                [
+                    'inv_title = :title:',
+                    'bind' => [
+                        'title' => 'first',
+                    ],
+                ]
+            )
+        );
+
+        $found = false;
+        foreach (Invoices::find() as $record) {
+            if (1 === (int) $record->inv_id) {
+                $I->assertSame($invoice, $record);
+                $found = true;
+            }
+        }
+        $I->assertTrue($found);
+
+        /**
+         * Saved records are registered, deleted records removed
+         */
+        $new                  = new Invoices();
+        $new->inv_cst_id      = 1;
+        $new->inv_status_flag = 1;
+        $new->inv_title       = 'third';
+        $new->inv_total       = 100;
+        $new->inv_created_at  = '2025-03-22 10:10:10';
+        $I->assertTrue($new->save());
+        $I->assertSame($new, Invoices::findFirst($new->inv_id));
+
+        $I->assertTrue($invoice->delete());
+        $I->assertNull($manager->getIdentity(Invoices::class, 1));
+        $I->assertNull(Invoices::findFirst(1));
+
+        /**
+         * Clearing
+         */
+        $second = Invoices::findFirst(2);
+        $manager->clearIdentityMap();
+        $I->assertNull($manager->getIdentity(Invoices::class, 2));
+        $I->assertNotSame($second, Invoices::findFirst(2));
+
+        $manager->useIdentityMap(false);
+        $I->assertFalse($manager->isUsingIdentityMap());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useIdentityMap() - changed primary
+     * key
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerUseIdentityMapChangedKey(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useIdentityMap() - changed key');
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->insert(1, 1, 0, 'first');
+
+        $manager = $this->container->getShared('modelsManager');
+        $manager->useIdentityMap();
+
+        $invoice = Invoices::findFirst(1);
+        $I->assertSame($invoice, $manager->getIdentity(Invoices::class, 1));
+
+        /**
+         * The record is only registered under its new primary key
+         */
+        $invoice->inv_id = 5;
+        $I->assertTrue($invoice->save());
+
+        $I->assertSame($invoice, $manager->getIdentity(Invoices::class, 5));
+        $I->assertNull($manager->getIdentity(Invoices::class, 1));
+
+        $I->assertTrue($invoice->delete());
+        $I->assertNull($manager->getIdentity(Invoices::class, 5));
+    }
+}
@@ -0,0 +1,131 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Query;
+
+use DatabaseTester;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+use Phalcon\Tests\Models\InvoicesSkipUpdate;
+
+/**
+ * Class BulkCest
+ */
+class BulkCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (\Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: setBulk()
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQuerySetBulk(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - setBulk()');
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->insert(1, 1, 0, 'one', 10);
+        $migration->insert(2, 1, 0, 'two', 20);
+        $migration->insert(3, 2, 0, 'three', 30);
+
+        $manager = $this->container->getShared('modelsManager');
+        $I->assertTrue($manager->isBulkWritable(new Invoices()));
+        $I->assertFalse($manager->isBulkWritable(new InvoicesSkipUpdate()));
+        $I->assertTrue($manager->isBulkWritable(new InvoicesSkipUpdate(), true));
+
+        /**
+         * Single statement
+         */
+        $query = $manager->createQuery(
+            'UPDATE [' . Invoices::class . '] SET inv_status_flag = :flag:, inv_total = inv_total + 1 '
+            . 'WHERE inv_cst_id = :cst:'
+        );
+        $I->assertFalse($query->getBulk());
+
+        $query->setBulk(
+            $manager->isBulkWritable(new Invoices())
+        );
+        $I->assertTrue($query->getBulk());
+
+        $status = $query->execute(
+            [
+                'flag' => Invoices::STATUS_PAID,
+                'cst'  => 1,
+            ]
+        );
+        $I->assertTrue($status->success());
+        $I->assertSame(2, $status->getAffectedRows());
+        $I->assertNull($status->getModel());
+
+        $invoice = Invoices::findFirst(2);
+        $I->assertEquals(Invoices::STATUS_PAID, $invoice->inv_status_flag);
+        $I->assertEquals(21, $invoice->inv_total);
+        $I->assertEquals(0, Invoices::findFirst(3)->inv_status_flag);
+
+        /**
+         * Record by record, the default
+         */
+        $status = $manager
+            ->createQuery(
+                'UPDATE [' . Invoices::class . '] SET inv_title = :title: WHERE inv_id IN ({ids:array})'
+            )
+            ->execute(
+                [
+                    'title' => 'updated',
+                    'ids'   => [1, 3],
+                ]
+            )
+        ;
+        $I->assertTrue($status->success());
+        $I->assertSame(2, $status->getAffectedRows());
+        $I->assertEquals('updated', Invoices::findFirst(3)->inv_title);
+
+        /**
+         * Delete, the alias is not part of the statement
+         */
+        $status = $manager
+            ->createQuery(
+                'DELETE FROM [' . Invoices::class . '] AS i WHERE i.inv_id IN ({ids:array})'
+            )
+            ->setBulk(true)
+            ->execute(
+                [
+                    'ids' => [1, 2],
+                ]
+            )
+        ;
+        $I->assertTrue($status->success());
+        $I->assertSame(2, $status->getAffectedRows());
+        $I->assertSame(1, Invoices::count());
+    }
+}
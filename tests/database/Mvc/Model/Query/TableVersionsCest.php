@@ -0,0 +1,246 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Query;
+
+use DatabaseTester;
+use Phalcon\Cache\AdapterFactory;
+use Phalcon\Cache\Cache;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Storage\SerializerFactory;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+
+use function cacheDir;
+
+/**
+ * Class TableVersionsCest
+ */
+class TableVersionsCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (\Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+
+        $this->container->setShared(
+            'modelsCache',
+            function () {
+                $adapterFactory = new AdapterFactory(new SerializerFactory());
+
+                return new Cache(
+                    $adapterFactory->newInstance(
+                        'stream',
+                        [
+                            'lifetime'   => 60,
+                            'storageDir' => cacheDir('mvcModelQueryTableVersions'),
+                        ]
+                    )
+                );
+            }
+        );
+    }
+
+    public function _after(DatabaseTester $I)
+    {
+        $this->container->getShared('modelsCache')->clear();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: cache() - without a key the cached
+     * resultset is invalidated by the writes on the table
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQueryCacheTableVersions(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - cache() - table versions');
+
+        (new InvoicesMigration($I->getConnection()));
+
+        $this->container
+            ->getShared('modelsManager')
+            ->setTableVersionsService('modelsCache')
+        ;
+
+        $options = [
+            'inv_cst_id = :cst:',
+            'bind'  => [
+                'cst' => 1,
+            ],
+            'cache' => [
+                'lifetime' => 60,
+            ],
+        ];
+
+        $result = Invoices::find($options);
+        $I->assertEquals(0, $result->count());
+        $I->assertTrue($result->isFresh());
+
+        $result = Invoices::find($options);
+        $I->assertEquals(0, $result->count());
+        $I->assertFalse($result->isFresh());
+
+        /**
+         * Inserting changes the version of the table
+         */
+        $invoice                  = new Invoices();
+        $invoice->inv_cst_id      = 1;
+        $invoice->inv_status_flag = Invoices::STATUS_PAID;
+        $invoice->inv_title       = 'cached invoice';
+        $invoice->inv_total       = 100;
+        $invoice->inv_created_at  = '2020-09-09 09:09:09';
+        $I->assertTrue($invoice->save());
+
+        $result = Invoices::find($options);
+        $I->assertEquals(1, $result->count());
+        $I->assertTrue($result->isFresh());
+
+        /**
+         * Other parameters are other entries
+         */
+        $other                = $options;
+        $other['bind']['cst'] = 2;
+
+        $result = Invoices::find($other);
+        $I->assertEquals(0, $result->count());
+        $I->assertTrue($result->isFresh());
+
+        $result = Invoices::find($options);
+        $I->assertFalse($result->isFresh());
+
+        /**
+         * Deleting too
+         */
+        $I->assertTrue($invoice->delete());
+
+        $result = Invoices::find($options);
+        $I->assertEquals(0, $result->count());
+        $I->assertTrue($result->isFresh());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: cache() - the tables written within a
+     * transaction are versioned again once it ends
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQueryCacheTableVersionsTransaction(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - cache() - table versions - transaction');
+
+        (new InvoicesMigration($I->getConnection()));
+
+        $this->container
+            ->getShared('modelsManager')
+            ->setTableVersionsService('modelsCache')
+        ;
+
+        $options = [
+            'inv_cst_id = :cst:',
+            'bind'  => [
+                'cst' => 1,
+            ],
+            'cache' => [
+                'lifetime' => 60,
+            ],
+        ];
+
+        $db = $this->container->getShared('db');
+        $db->begin();
+
+        $invoice                  = new Invoices();
+        $invoice->inv_cst_id      = 1;
+        $invoice->inv_status_flag = Invoices::STATUS_PAID;
+        $invoice->inv_title       = 'cached invoice';
+        $invoice->inv_total       = 100;
+        $invoice->inv_created_at  = '2020-09-09 09:09:09';
+        $I->assertTrue($invoice->save());
+
+        /**
+         * The uncommitted record is cached with the new version
+         */
+        $result = Invoices::find($options);
+        $I->assertEquals(1, $result->count());
+        $I->assertTrue($result->isFresh());
+
+        $result = Invoices::find($options);
+        $I->assertFalse($result->isFresh());
+
+        $db->rollback();
+
+        /**
+         * The entry cached within the transaction is not used anymore
+         */
+        $result = Invoices::find($options);
+        $I->assertEquals(0, $result->count());
+        $I->assertTrue($result->isFresh());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: cache() - a key is required when the
+     * table versions are not enabled
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQueryCacheWithoutKey(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - cache() - without key');
+
+        (new InvoicesMigration($I->getConnection()));
+
+        $I->expectThrowable(
+            new Exception(
+                'A cache key must be provided to identify the cached resultset in the cache backend'
+            ),
+            function () {
+                Invoices::find(
+                    [
+                        'cache' => [
+                            'lifetime' => 60,
+                        ],
+                    ]
+                );
+            }
+        );
+    }
+}
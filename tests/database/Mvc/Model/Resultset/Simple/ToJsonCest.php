@@ -0,0 +1,113 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model\Resultset\Simple;
+
+use DatabaseTester;
+use PDO;
+use Phalcon\Mvc\Model\Resultset;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Fixtures\Traits\RecordsTrait;
+use Phalcon\Tests\Models\Invoices;
+use Phalcon\Tests\Models\InvoicesMap;
+
+use function json_encode;
+
+use const JSON_PRETTY_PRINT;
+use const JSON_UNESCAPED_UNICODE;
+
+class ToJsonCest
+{
+    use DiTrait;
+    use RecordsTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $invId      = ('sqlite' === $I->getDriver()) ? 'null' : 'default';
+
+        $this->insertDataInvoices($migration, 5, $invId, 2, 'ünïcode "quoted"');
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset\Simple :: toJson()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function mvcModelResultsetSimpleToJson(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset\Simple - toJson()');
+
+        $invoices = InvoicesMap::find(['order' => 'id']);
+
+        $expected = json_encode($invoices->toArray());
+        $actual   = $invoices->toJson();
+        $I->assertSame($expected, $actual);
+        $I->assertStringContainsString('"title":', $actual);
+
+        $expected = json_encode($invoices->toArray(), JSON_UNESCAPED_UNICODE);
+        $actual   = $invoices->toJson(JSON_UNESCAPED_UNICODE);
+        $I->assertSame($expected, $actual);
+
+        $expected = json_encode($invoices->toArray(), JSON_PRETTY_PRINT);
+        $actual   = $invoices->toJson(JSON_PRETTY_PRINT);
+        $I->assertSame($expected, $actual);
+
+        $invoices = Invoices::find(['order' => 'inv_id']);
+
+        $expected = json_encode($invoices->toArray());
+        $actual   = $invoices->toJson();
+        $I->assertSame($expected, $actual);
+
+        $invoices = Invoices::find('inv_id < 0');
+
+        $I->assertSame('[]', $invoices->toJson());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset\Simple :: jsonSerialize() - arrays
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function mvcModelResultsetSimpleJsonSerializeArrays(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset\Simple - jsonSerialize() - arrays');
+
+        $invoices = InvoicesMap::find(['order' => 'id']);
+        $invoices->setHydrateMode(Resultset::HYDRATE_ARRAYS);
+
+        $expected = [];
+        foreach ($invoices as $invoice) {
+            $expected[] = $invoice;
+        }
+
+        $I->assertSame($expected, $invoices->jsonSerialize());
+        $I->assertSame($invoices->toArray(), $invoices->jsonSerialize());
+    }
+}
@@ -0,0 +1,188 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Mvc\Model;
+
+use DatabaseTester;
+use PDO;
+use Phalcon\Events\Event;
+use Phalcon\Events\Manager;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Models\Invoices;
+
+use function uniqid;
+
+class UpsertCest
+{
+    use DiTrait;
+
+    /**
+     * @var array
+     */
+    private $statements = [];
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        (new InvoicesMigration($connection));
+
+        /**
+         * Load the metadata before logging the statements
+         */
+        $invoice = new Invoices();
+        $invoice->getModelsMetaData()->getAttributes($invoice);
+
+        $this->statements = [];
+
+        $db      = $this->container->get('db');
+        $manager = new Manager();
+        $manager->attach(
+            'db:beforeQuery',
+            function (Event $event, $db) {
+                $this->statements[] = $db->getSQLStatement();
+            }
+        );
+
+        $db->setEventsManager($manager);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function mvcModelUpsert(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - upsert()');
+
+        $title                    = uniqid('inv-');
+        $invoice                  = new Invoices();
+        $invoice->inv_id          = 1000;
+        $invoice->inv_cst_id      = 2;
+        $invoice->inv_status_flag = 1;
+        $invoice->inv_title       = $title;
+        $invoice->inv_total       = 100.12;
+
+        $actual = $invoice->upsert();
+        $I->assertTrue($actual);
+
+        $invoice                  = new Invoices();
+        $invoice->inv_id          = 1000;
+        $invoice->inv_cst_id      = 2;
+        $invoice->inv_status_flag = 0;
+        $invoice->inv_title       = $title;
+        $invoice->inv_total       = 200.24;
+
+        $actual = $invoice->upsert();
+        $I->assertTrue($actual);
+
+        /**
+         * One statement per upsert
+         */
+        $I->assertCount(2, $this->statements);
+        foreach ($this->statements as $statement) {
+            $I->assertStringStartsWith('INSERT INTO', $statement);
+        }
+
+        $I->assertEquals(1, Invoices::count('inv_id = 1000'));
+
+        $invoice = Invoices::findFirst('inv_id = 1000');
+        $I->assertEquals(0, $invoice->inv_status_flag);
+        $I->assertEquals(200.24, $invoice->inv_total);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: upsert() - generated identity
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function mvcModelUpsertIdentity(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - upsert() - generated identity');
+
+        $invoice                  = new Invoices();
+        $invoice->inv_cst_id      = 2;
+        $invoice->inv_status_flag = 1;
+        $invoice->inv_title       = uniqid('inv-');
+        $invoice->inv_total       = 100.12;
+
+        $actual = $invoice->upsert();
+        $I->assertTrue($actual);
+        $I->assertGreaterThan(0, (int) $invoice->inv_id);
+
+        $expected = Invoices::DIRTY_STATE_PERSISTENT;
+        $actual   = $invoice->getDirtyState();
+        $I->assertSame($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: markAsNew() / markAsPersistent()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function mvcModelUpsertKnownState(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - markAsNew() / markAsPersistent()');
+
+        $title                    = uniqid('inv-');
+        $invoice                  = new Invoices();
+        $invoice->inv_id          = 2000;
+        $invoice->inv_cst_id      = 2;
+        $invoice->inv_status_flag = 1;
+        $invoice->inv_title       = $title;
+        $invoice->inv_total       = 100.12;
+
+        $actual = $invoice->markAsNew()->save();
+        $I->assertTrue($actual);
+
+        $invoice                  = new Invoices();
+        $invoice->inv_id          = 2000;
+        $invoice->inv_cst_id      = 2;
+        $invoice->inv_status_flag = 0;
+        $invoice->inv_title       = $title;
+        $invoice->inv_total       = 200.24;
+
+        $actual = $invoice->markAsPersistent()->save();
+        $I->assertTrue($actual);
+
+        /**
+         * No existence check
+         */
+        $I->assertCount(2, $this->statements);
+        $I->assertStringStartsWith('INSERT INTO', $this->statements[0]);
+        $I->assertStringStartsWith('UPDATE', $this->statements[1]);
+
+        $invoice = Invoices::findFirst('inv_id = 2000');
+        $I->assertEquals(0, $invoice->inv_status_flag);
+    }
+}
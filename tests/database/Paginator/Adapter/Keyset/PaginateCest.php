@@ -0,0 +1,229 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Database\Paginator\Adapter\Keyset;
+
+use DatabaseTester;
+use PDO;
+use Phalcon\Paginator\Adapter\Keyset;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\Repository;
+use Phalcon\Tests\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+use Phalcon\Tests\Fixtures\Traits\RecordsTrait;
+use Phalcon\Tests\Models\Invoices;
+
+class PaginateCest
+{
+    use DiTrait;
+    use RecordsTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $invId      = ('sqlite' === $I->getDriver()) ? 'null' : 'default';
+
+        $this->insertDataInvoices($migration, 7, $invId, 2, 'ccc');
+        $this->insertDataInvoices($migration, 10, $invId, 3, 'aaa');
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginate(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate()');
+
+        $expected = $this->getIds(
+            Invoices::find(['order' => 'inv_id'])
+        );
+
+        $paginator = $this->newPaginator(['inv_id']);
+        $pages     = [];
+        $cursors   = [];
+
+        do {
+            $page = $paginator->paginate();
+
+            $I->assertInstanceOf(Repository::class, $page);
+            $I->assertEquals(5, $page->getLimit());
+            $I->assertEquals(0, $page->getTotalItems());
+
+            $pages[]   = $this->getIds($page->getItems());
+            $cursors[] = $page->getPreviousCursor();
+
+            $paginator->setCursor($page->getNextCursor());
+        } while (null !== $page->getNextCursor());
+
+        $I->assertCount(4, $pages);
+        $I->assertNull($cursors[0]);
+        $I->assertSame($expected, array_merge(...$pages));
+
+        /**
+         * Going back from the last page
+         */
+        $paginator->setCursor($cursors[3]);
+        $page = $paginator->paginate();
+
+        $I->assertSame($pages[2], $this->getIds($page->getItems()));
+        $I->assertNotNull($page->getPreviousCursor());
+
+        $paginator->setCursor($cursors[1]);
+        $page = $paginator->paginate();
+
+        $I->assertSame($pages[0], $this->getIds($page->getItems()));
+        $I->assertNull($page->getPreviousCursor());
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate() - several columns
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginateColumns(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate() - several columns');
+
+        $expected = $this->getIds(
+            Invoices::find(['order' => 'inv_cst_id DESC, inv_id'])
+        );
+
+        $paginator = $this->newPaginator(
+            [
+                'inv_cst_id' => 'desc',
+                'inv_id',
+            ],
+            true
+        );
+
+        $page = $paginator->paginate();
+        $I->assertEquals(17, $page->getTotalItems());
+
+        $pages = [$this->getIds($page->getItems())];
+        while (null !== $page->getNextCursor()) {
+            $paginator->setCursor($page->getNextCursor());
+
+            $page    = $paginator->paginate();
+            $pages[] = $this->getIds($page->getItems());
+        }
+
+        $I->assertSame($expected, array_merge(...$pages));
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate() - total multiple
+     * of the limit
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginateExactPages(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate() - total multiple of the limit');
+
+        /**
+         * 15 rows, 3 full pages
+         */
+        Invoices::find(['order' => 'inv_id', 'limit' => 2])->delete();
+
+        $paginator = $this->newPaginator(['inv_id']);
+        $pages     = [];
+
+        do {
+            $page    = $paginator->paginate();
+            $pages[] = $this->getIds($page->getItems());
+
+            $paginator->setCursor($page->getNextCursor());
+        } while (null !== $page->getNextCursor());
+
+        /**
+         * The last full page has no next page
+         */
+        $I->assertCount(3, $pages);
+        $I->assertCount(5, $pages[2]);
+        $I->assertNotNull($page->getPreviousCursor());
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate() - invalid cursor
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginateInvalidCursor(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate() - invalid cursor');
+
+        $I->expectThrowable(
+            new Exception('The cursor is not valid'),
+            function () {
+                $this->newPaginator(['inv_id'])
+                     ->setCursor('not-a-cursor')
+                     ->paginate()
+                ;
+            }
+        );
+    }
+
+    private function getIds($items): array
+    {
+        $ids = [];
+        foreach ($items as $item) {
+            $ids[] = (int) $item->inv_id;
+        }
+
+        return $ids;
+    }
+
+    private function newPaginator(array $columns, $count = false): Keyset
+    {
+        $builder = $this->getService('modelsManager')
+            ->createBuilder()
+            ->from(Invoices::class)
+        ;
+
+        return new Keyset(
+            [
+                'builder' => $builder,
+                'columns' => $columns,
+                'count'   => $count,
+                'limit'   => 5,
+            ]
+        );
+    }
+}
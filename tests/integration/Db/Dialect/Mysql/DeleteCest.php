@@ -0,0 +1,120 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Db\Dialect\Mysql;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Mysql;
+
+class DeleteCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: delete()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dbDialectMysqlDelete(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - delete()');
+
+        $dialect = new Mysql();
+
+        $expected = 'DELETE FROM `robots` WHERE `robots`.`year` < 2000';
+        $actual   = $dialect->delete(
+            [
+                'tables' => [['robots', null]],
+                'where'  => [
+                    'type'  => 'binary-op',
+                    'op'    => '<',
+                    'left'  => [
+                        'type'   => 'qualified',
+                        'domain' => 'robots',
+                        'name'   => 'year',
+                    ],
+                    'right' => ['type' => 'literal', 'value' => '2000'],
+                ],
+            ]
+        );
+        $I->assertSame($expected, $actual);
+
+        $expected = 'DELETE FROM `robots`';
+        $actual   = $dialect->delete(
+            [
+                'tables' => ['robots'],
+            ]
+        );
+        $I->assertSame($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: delete() - alias
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dbDialectMysqlDeleteAlias(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - delete() - alias');
+
+        $dialect = new Mysql();
+        $where   = [
+            'type'  => 'binary-op',
+            'op'    => 'AND',
+            'left'  => [
+                'type'  => 'binary-op',
+                'op'    => '<',
+                'left'  => [
+                    'type'   => 'qualified',
+                    'domain' => 'r',
+                    'name'   => 'year',
+                ],
+                'right' => ['type' => 'literal', 'value' => '2000'],
+            ],
+            'right' => [
+                'type'  => 'binary-op',
+                'op'    => '=',
+                'left'  => [
+                    'type'   => 'qualified',
+                    'domain' => 'r',
+                    'name'   => 'type',
+                ],
+                'right' => ['type' => 'placeholder', 'value' => ':type'],
+            ],
+        ];
+
+        /**
+         * The alias is dropped and the columns are qualified with the table
+         */
+        $expected = 'DELETE FROM `robots` WHERE `robots`.`year` < 2000 '
+            . 'AND `robots`.`type` = :type';
+        $actual   = $dialect->delete(
+            [
+                'tables' => [['robots', null, 'r']],
+                'where'  => $where,
+            ]
+        );
+        $I->assertSame($expected, $actual);
+
+        $expected = 'DELETE FROM `phalcon`.`robots` WHERE '
+            . '`phalcon`.`robots`.`year` < 2000 '
+            . 'AND `phalcon`.`robots`.`type` = :type';
+        $actual   = $dialect->delete(
+            [
+                'tables' => [['robots', 'phalcon', 'r']],
+                'where'  => $where,
+            ]
+        );
+        $I->assertSame($expected, $actual);
+    }
+}
@@ -0,0 +1,69 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Db\Dialect\Mysql;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Mysql;
+
+class UpdateCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: update()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dbDialectMysqlUpdate(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - update()');
+
+        $dialect = new Mysql();
+
+        $expected = 'UPDATE `shop`.`robots` AS `r` SET `status` = 1, `name` = :name '
+            . 'WHERE `r`.`year` < :year';
+        $actual   = $dialect->update(
+            [
+                'tables' => [['robots', 'shop', 'r']],
+                'fields' => ['status', 'name'],
+                'values' => [
+                    ['type' => 'literal', 'value' => '1'],
+                    ['type' => 'placeholder', 'value' => ':name'],
+                ],
+                'where'  => [
+                    'type'  => 'binary-op',
+                    'op'    => '<',
+                    'left'  => [
+                        'type'   => 'qualified',
+                        'domain' => 'r',
+                        'name'   => 'year',
+                    ],
+                    'right' => ['type' => 'placeholder', 'value' => ':year'],
+                ],
+            ]
+        );
+        $I->assertSame($expected, $actual);
+
+        $expected = 'UPDATE `robots` SET `status` = NULL';
+        $actual   = $dialect->update(
+            [
+                'tables' => [['robots', null]],
+                'fields' => ['status'],
+                'values' => [
+                    ['type' => 'literal', 'value' => 'NULL'],
+                ],
+            ]
+        );
+        $I->assertSame($expected, $actual);
+    }
+}
@@ -0,0 +1,65 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Db\Dialect\Mysql;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Mysql;
+use Phalcon\Db\Dialect\Postgresql;
+use Phalcon\Db\Dialect\Sqlite;
+
+class UpsertCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dbDialectMysqlUpsert(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - upsert()');
+
+        $dialect = new Mysql();
+        $insert  = 'INSERT INTO `robots` (`id`, `name`, `year`) VALUES (?, ?, ?)';
+
+        $expected = $insert . ' ON DUPLICATE KEY UPDATE `name` = VALUES(`name`), `year` = VALUES(`year`)';
+        $actual   = $dialect->upsert($insert, ['id'], ['name', 'year']);
+        $I->assertSame($expected, $actual);
+
+        $expected = $insert . ' ON DUPLICATE KEY UPDATE `id` = VALUES(`id`)';
+        $actual   = $dialect->upsert($insert, ['id'], []);
+        $I->assertSame($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Db\Dialect :: upsert() - ON CONFLICT
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function dbDialectUpsertOnConflict(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect - upsert() - ON CONFLICT');
+
+        $insert = 'INSERT INTO "robots" ("id", "name") VALUES (?, ?)';
+
+        $expected = $insert . ' ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"';
+        $actual   = (new Postgresql())->upsert($insert, ['id'], ['name']);
+        $I->assertSame($expected, $actual);
+
+        $expected = $insert . ' ON CONFLICT ("id") DO NOTHING';
+        $actual   = (new Sqlite())->upsert($insert, ['id'], []);
+        $I->assertSame($expected, $actual);
+    }
+}
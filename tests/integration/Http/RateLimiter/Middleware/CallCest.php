@@ -0,0 +1,94 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Http\RateLimiter\Middleware;
+
+use IntegrationTester;
+use Phalcon\Di\FactoryDefault;
+use Phalcon\Http\RateLimiter\Middleware;
+use Phalcon\Mvc\Micro;
+use Phalcon\Storage\Adapter\Memory;
+use Phalcon\Storage\RateLimiter;
+use Phalcon\Storage\SerializerFactory;
+
+use function function_exists;
+use function ob_end_clean;
+use function ob_start;
+use function xdebug_get_headers;
+
+class CallCest
+{
+    /**
+     * Tests Phalcon\Http\RateLimiter\Middleware :: call()
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function httpRateLimiterMiddlewareCall(IntegrationTester $I)
+    {
+        $I->wantToTest('Http\RateLimiter\Middleware - call()');
+
+        $container   = new FactoryDefault();
+        $application = new Micro($container);
+        $limiter     = new RateLimiter(
+            new Memory(new SerializerFactory()),
+            1,
+            60
+        );
+        $calls       = 0;
+
+        $application->before(
+            new Middleware(
+                $limiter,
+                function () {
+                    return 'client';
+                }
+            )
+        );
+
+        $application->get(
+            '/',
+            function () use (&$calls) {
+                $calls++;
+
+                return 'handled';
+            }
+        );
+
+        /**
+         * The only token is taken, the 429 is sent and the handler is not
+         * called
+         */
+        $I->assertTrue($limiter->consume('client'));
+
+        ob_start();
+        $application->handle('/');
+        ob_end_clean();
+
+        $response = $container->getShared('response');
+
+        $I->assertSame(0, $calls);
+        $I->assertTrue($response->isSent());
+        $I->assertSame(429, $response->getStatusCode());
+        $I->assertSame('1', $response->getHeaders()->get('X-RateLimit-Limit'));
+
+        if (function_exists('xdebug_get_headers')) {
+            $I->assertContains(
+                'Status: 429 Too Many Requests',
+                xdebug_get_headers()
+            );
+        }
+    }
+}
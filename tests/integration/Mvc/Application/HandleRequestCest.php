@@ -0,0 +1,192 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\Application;
+
+use IntegrationTester;
+use Phalcon\Di\FactoryDefault;
+use Phalcon\Di\ResettableInterface;
+use Phalcon\Html\Escaper;
+use Phalcon\Mvc\Application;
+use Phalcon\Mvc\Dispatcher;
+use Phalcon\Mvc\View;
+use Phalcon\Tests\Controllers\MicroController;
+
+use function dataDir;
+use function spl_object_hash;
+
+class HandleRequestCest
+{
+    /**
+     * Tests Phalcon\Mvc\Application :: handleRequest()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcApplicationHandleRequest(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Application - handleRequest()');
+
+        $di = new FactoryDefault();
+
+        $di->setShared(
+            'view',
+            function () {
+                $view = new View();
+
+                $view->setViewsDir(
+                    dataDir('fixtures/views/simple/')
+                );
+
+                return $view;
+            }
+        );
+
+        $di->setShared(
+            'dispatcher',
+            function () {
+                $dispatcher = new Dispatcher();
+                $dispatcher->setDefaultNamespace(
+                    'Phalcon\Tests\Controllers'
+                );
+
+                return $dispatcher;
+            }
+        );
+
+        $di->setShared('requestEscaper', Escaper::class);
+
+        $application = new Application();
+        $application->setDI($di);
+
+        $escaper  = $di->getShared('requestEscaper');
+        $response = $application->handleRequest('/micro', ['requestEscaper']);
+        $I->assertEquals('We are here', $response->getContent());
+
+        /**
+         * The services in the list are created again
+         */
+        $I->assertNotSame(
+            spl_object_hash($escaper),
+            spl_object_hash($di->getShared('requestEscaper'))
+        );
+
+        $router     = $di->getShared('router');
+        $dispatcher = $di->getShared('dispatcher');
+        $view       = $di->getShared('view');
+        $response   = $di->getShared('response');
+        $I->assertInstanceOf(ResettableInterface::class, $router);
+        $I->assertInstanceOf(ResettableInterface::class, $dispatcher);
+        $I->assertInstanceOf(ResettableInterface::class, $response);
+        $I->assertInstanceOf(ResettableInterface::class, $view);
+        $I->assertSame('micro', $router->getControllerName());
+        $I->assertSame('micro', $dispatcher->getControllerName());
+
+        /**
+         * The state of the previous request is removed
+         */
+        $view->setVar('leaked', 'value');
+
+        /**
+         * View::reset() keeps the variables
+         */
+        $view->reset();
+        $I->assertSame('value', $view->getVar('leaked'));
+
+        $di->resetRequestScope();
+
+        $I->assertFalse($router->wasMatched());
+        $I->assertNull($router->getMatchedRoute());
+        $I->assertSame('', $router->getControllerName());
+        $I->assertSame('', $dispatcher->getControllerName());
+        $I->assertNull($dispatcher->getReturnedValue());
+        $I->assertFalse($response->isSent());
+        $I->assertSame('', $response->getContent());
+        $I->assertNull($view->getVar('leaked'));
+
+        $response = $application->handleRequest('/micro');
+        $I->assertEquals('We are here', $response->getContent());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Application :: handleRequest() - controllers
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcApplicationHandleRequestControllers(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Application - handleRequest() - controllers');
+
+        $di = new FactoryDefault();
+
+        $di->setShared(
+            'view',
+            function () {
+                $view = new View();
+
+                $view->setViewsDir(
+                    dataDir('fixtures/views/simple/')
+                );
+
+                return $view;
+            }
+        );
+
+        $di->setShared(
+            'dispatcher',
+            function () {
+                $dispatcher = new Dispatcher();
+                $dispatcher->setDefaultNamespace(
+                    'Phalcon\Tests\Controllers'
+                );
+
+                return $dispatcher;
+            }
+        );
+
+        $application = new Application();
+        $application->setDI($di);
+
+        $application->handleRequest('/micro');
+
+        $dispatcher = $di->getShared('dispatcher');
+        $controller = $dispatcher->getActiveController();
+        $I->assertInstanceOf(MicroController::class, $controller);
+        $I->assertSame(
+            [MicroController::class],
+            $dispatcher->getResolvedHandlers()
+        );
+
+        /**
+         * The controller of the previous request is not dispatched again
+         */
+        $response = $application->handleRequest('/micro');
+        $I->assertEquals('We are here', $response->getContent());
+
+        $actual = $dispatcher->getActiveController();
+        $I->assertInstanceOf(MicroController::class, $actual);
+        $I->assertNotSame(
+            spl_object_hash($controller),
+            spl_object_hash($actual)
+        );
+
+        $di->resetRequestScope();
+
+        $I->assertSame([], $dispatcher->getResolvedHandlers());
+        $I->assertNotSame(
+            spl_object_hash($actual),
+            spl_object_hash($di->getShared(MicroController::class))
+        );
+    }
+}
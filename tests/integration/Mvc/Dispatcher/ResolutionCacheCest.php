@@ -0,0 +1,228 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\Dispatcher;
+
+use IntegrationTester;
+use Phalcon\Cache\Adapter\Memory;
+use Phalcon\Dispatcher\Exception;
+use Phalcon\Storage\SerializerFactory;
+use Phalcon\Tests\Integration\Mvc\Dispatcher\Helper\BaseDispatcher;
+use Phalcon\Tests\Integration\Mvc\Dispatcher\Helper\DispatcherTestDefaultController;
+
+use function md5;
+
+class ResolutionCacheCest extends BaseDispatcher
+{
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: setResolutionCache()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcDispatcherSetResolutionCache(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - setResolutionCache()');
+
+        $cache      = new Memory(new SerializerFactory());
+        $dispatcher = $this->getDispatcher();
+
+        $dispatcher->setResolutionCache($cache);
+        $I->assertSame($cache, $dispatcher->getResolutionCache());
+
+        $handler = $dispatcher->dispatch();
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+
+        $key = '_PHDR_' . md5(
+            'Phalcon\Tests\Integration\Mvc\Dispatcher\Helper' .
+            '|dispatcher-test-default|index|Controller|Action'
+        );
+
+        $expected = [
+            'afterBinding'       => false,
+            'afterExecuteRoute'  => true,
+            'beforeExecuteRoute' => true,
+            'class'              => DispatcherTestDefaultController::class,
+            'handler'            => DispatcherTestDefaultController::class,
+            'initialize'         => true,
+            'method'             => 'indexAction',
+        ];
+        $I->assertSame($expected, $cache->get($key));
+
+        /**
+         * The hooks of the resolution are called
+         */
+        $expected = [
+            'beforeDispatchLoop',
+            'beforeDispatch',
+            'beforeExecuteRoute',
+            'beforeExecuteRoute-method',
+            'initialize-method',
+            'afterInitialize',
+            'indexAction',
+            'afterExecuteRoute',
+            'afterExecuteRoute-method',
+            'afterDispatch',
+            'afterDispatchLoop',
+        ];
+        $I->assertSame($expected, $this->getDispatcherListener()->getTrace());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: dispatch() - cached resolution
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcDispatcherDispatchCachedResolution(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - dispatch() - cached resolution');
+
+        $cache = new Memory(new SerializerFactory());
+        $key   = '_PHDR_' . md5(
+            'Phalcon\Tests\Integration\Mvc\Dispatcher\Helper' .
+            '|dispatcher-test-cached|index|Controller|Action'
+        );
+
+        /**
+         * A handler name without a class is dispatched from the cache
+         */
+        $cache->set(
+            $key,
+            [
+                'afterBinding'       => false,
+                'afterExecuteRoute'  => true,
+                'beforeExecuteRoute' => true,
+                'class'              => DispatcherTestDefaultController::class,
+                'handler'            => DispatcherTestDefaultController::class,
+                'initialize'         => true,
+                'method'             => 'indexAction',
+            ]
+        );
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache($cache);
+        $dispatcher->setControllerName('dispatcher-test-cached');
+
+        $handler = $dispatcher->dispatch();
+
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+        $I->assertSame('indexAction', $dispatcher->getActiveMethod());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Dispatcher :: dispatch() - stale resolution
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcDispatcherDispatchStaleResolution(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Dispatcher - dispatch() - stale resolution');
+
+        $cache = new Memory(new SerializerFactory());
+        $key   = '_PHDR_' . md5(
+            'Phalcon\Tests\Integration\Mvc\Dispatcher\Helper' .
+            '|dispatcher-test-default|index|Controller|Action'
+        );
+
+        /**
+         * The cached method does not exist anymore, the action is resolved
+         * again and cached
+         */
+        $cache->set(
+            $key,
+            [
+                'afterBinding'       => false,
+                'afterExecuteRoute'  => true,
+                'beforeExecuteRoute' => true,
+                'class'              => DispatcherTestDefaultController::class,
+                'handler'            => DispatcherTestDefaultController::class,
+                'initialize'         => true,
+                'method'             => 'removedAction',
+            ]
+        );
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache($cache);
+
+        $handler = $dispatcher->dispatch();
+
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+        $I->assertSame('indexAction', $cache->get($key)['method']);
+
+        /**
+         * The cached class does not exist anymore
+         */
+        $cache->set(
+            $key,
+            [
+                'afterBinding'       => false,
+                'afterExecuteRoute'  => false,
+                'beforeExecuteRoute' => false,
+                'class'              => 'Phalcon\Tests\RemovedController',
+                'handler'            => 'Phalcon\Tests\RemovedController',
+                'initialize'         => false,
+                'method'             => 'indexAction',
+            ]
+        );
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache($cache);
+
+        $handler = $dispatcher->dispatch();
+
+        $I->assertInstanceOf(DispatcherTestDefaultController::class, $handler);
+        $I->assertSame(
+            DispatcherTestDefaultController::class,
+            $cache->get($key)['class']
+        );
+
+        /**
+         * An action that is not found anymore is not cached
+         */
+        $key = '_PHDR_' . md5(
+            'Phalcon\Tests\Integration\Mvc\Dispatcher\Helper' .
+            '|dispatcher-test-default|removed|Controller|Action'
+        );
+
+        $cache->set(
+            $key,
+            [
+                'afterBinding'       => false,
+                'afterExecuteRoute'  => true,
+                'beforeExecuteRoute' => true,
+                'class'              => DispatcherTestDefaultController::class,
+                'handler'            => DispatcherTestDefaultController::class,
+                'initialize'         => true,
+                'method'             => 'removedAction',
+            ]
+        );
+
+        $dispatcher = $this->getDispatcher();
+        $dispatcher->setResolutionCache($cache);
+        $dispatcher->setActionName('removed');
+
+        $I->expectThrowable(
+            new Exception(
+                "Action 'removed' was not found on handler 'dispatcher-test-default'",
+                Exception::EXCEPTION_ACTION_NOT_FOUND
+            ),
+            function () use ($dispatcher) {
+                $dispatcher->dispatch();
+            }
+        );
+
+        $I->assertFalse($cache->has($key));
+    }
+}
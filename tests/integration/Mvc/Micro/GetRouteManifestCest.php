@@ -0,0 +1,228 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Mvc\Micro;
+
+use IntegrationTester;
+use Phalcon\Mvc\Micro;
+use Phalcon\Mvc\Micro\Collection;
+use Phalcon\Mvc\Micro\Exception;
+use Phalcon\Mvc\Micro\LazyLoader;
+use Phalcon\Mvc\Router\Group;
+use Phalcon\Tests\Fixtures\Micro\RestHandler;
+
+use function var_export;
+
+/**
+ * Class GetRouteManifestCest
+ */
+class GetRouteManifestCest
+{
+    /**
+     * Tests Phalcon\Mvc\Micro :: getRouteManifest()/loadRouteManifest()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcMicroGetRouteManifest(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Micro - getRouteManifest()/loadRouteManifest()');
+
+        $app        = new Micro();
+        $collection = new Collection();
+
+        $collection
+            ->setHandler(RestHandler::class, true)
+            ->setPrefix('/rest')
+            ->get('/', 'find', 'rest-find')
+            ->post('/', 'save')
+        ;
+
+        $app->mount($collection);
+        $app->get('/version', 'phpversion');
+
+        $manifest = $app->getRouteManifest();
+        $I->assertCount(3, $manifest);
+        $I->assertSame(
+            [
+                'pattern'     => '/rest',
+                'paths'       => [],
+                'methods'     => 'GET',
+                'name'        => 'rest-find',
+                'hostname'    => null,
+                'converters'  => [],
+                'beforeMatch' => null,
+                'group'       => null,
+                'handler'     => [
+                    'lazy'       => true,
+                    'definition' => RestHandler::class,
+                    'method'     => 'find',
+                ],
+            ],
+            $manifest[0]
+        );
+
+        /**
+         * A new application maps the exported routes
+         */
+        $manifest = eval('return ' . var_export($manifest, true) . ';');
+
+        $app = new Micro();
+        $app->loadRouteManifest($manifest);
+        $app->setResponseHandler(
+            function () use ($app) {
+                return $app->getReturnedValue();
+            }
+        );
+
+        $I->assertCount(3, $app->getHandlers());
+        $I->assertSame(
+            '/rest',
+            $app->getRouter()->getRouteByName('rest-find')->getPattern()
+        );
+
+        $_SERVER['REQUEST_METHOD'] = 'GET';
+
+        $app->handle('/rest');
+
+        $handler = $app->getActiveHandler();
+        $I->assertInstanceOf(LazyLoader::class, $handler[0]);
+        $I->assertSame(['find'], $handler[0]->getHandler()->getTrace());
+
+        $I->assertSame(PHP_VERSION, $app->handle('/version'));
+
+        unset($_SERVER['REQUEST_METHOD']);
+
+        /**
+         * Closures cannot be exported
+         */
+        $I->expectThrowable(
+            new Exception("The handler of the route '/closure' cannot be exported"),
+            function () use ($app) {
+                $app->get(
+                    '/closure',
+                    function () {
+                        return 'closure';
+                    }
+                );
+
+                $app->getRouteManifest();
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Micro :: getRouteManifest() - converters,
+     * beforeMatch and groups
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcMicroGetRouteManifestRouteOptions(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Micro - getRouteManifest() - route options');
+
+        $group = new Group(['module' => 'api']);
+        $group->setPrefix('/v1');
+
+        $app = new Micro();
+        $app
+            ->get('/v1/reverse/{text}', 'strrev')
+            ->convert('text', 'strtoupper')
+            ->setGroup($group)
+        ;
+        $app
+            ->get('/v1/match', 'phpversion')
+            ->beforeMatch([RestHandler::class, 'find'])
+            ->setGroup($group)
+        ;
+
+        $manifest = eval(
+            'return ' . var_export($app->getRouteManifest(), true) . ';'
+        );
+
+        $app = new Micro();
+        $app->loadRouteManifest($manifest);
+        $app->setResponseHandler(
+            function () use ($app) {
+                return $app->getReturnedValue();
+            }
+        );
+
+        $routes = $app->getRouter()->getRoutes();
+        $I->assertSame(['text' => 'strtoupper'], $routes[0]->getConverters());
+        $I->assertSame(
+            [RestHandler::class, 'find'],
+            $routes[1]->getBeforeMatch()
+        );
+
+        /**
+         * The routes of a group share it again
+         */
+        $group = $routes[0]->getGroup();
+        $I->assertInstanceOf(Group::class, $group);
+        $I->assertSame($group, $routes[1]->getGroup());
+        $I->assertSame('/v1', $group->getPrefix());
+        $I->assertSame(['module' => 'api'], $group->getPaths());
+
+        /**
+         * The converters are applied to the loaded routes
+         */
+        $_SERVER['REQUEST_METHOD'] = 'GET';
+
+        $I->assertSame('CBA', $app->handle('/v1/reverse/abc'));
+
+        unset($_SERVER['REQUEST_METHOD']);
+
+        /**
+         * Closures cannot be exported
+         */
+        $I->expectThrowable(
+            new Exception(
+                "The converter of 'id' in the route '/closure/{id}' cannot be exported"
+            ),
+            function () use ($app) {
+                $app
+                    ->get('/closure/{id}', 'phpversion')
+                    ->convert(
+                        'id',
+                        function ($id) {
+                            return (int) $id;
+                        }
+                    )
+                ;
+
+                $app->getRouteManifest();
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception(
+                "The beforeMatch callback of the route '/match' cannot be exported"
+            ),
+            function () {
+                $app = new Micro();
+                $app
+                    ->get('/match', 'phpversion')
+                    ->beforeMatch(
+                        function () {
+                            return true;
+                        }
+                    )
+                ;
+
+                $app->getRouteManifest();
+            }
+        );
+    }
+}
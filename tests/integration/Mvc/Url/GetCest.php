@@ -15,6 +15,7 @@ namespace Phalcon\Tests\Integration\Mvc\Url;
 
 use Codeception\Example;
 use IntegrationTester;
+use Phalcon\Mvc\Router;
 use Phalcon\Mvc\Url;
 
 class GetCest
@@ -40,6 +41,95 @@ class GetCest
         $I->assertEquals($expected, $actual);
     }
 
+    /**
+     * Tests Phalcon\Mvc\Url :: get() - compiled routes
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function mvcUrlGetCompiledRoutes(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Url - get() - compiled routes');
+
+        $router = new Router(false);
+        $router
+            ->add(
+                '/admin/:controller/p/:action/:params',
+                [
+                    'controller' => 1,
+                    'action'     => 2,
+                    'params'     => 3,
+                ]
+            )
+            ->setName('admin')
+        ;
+        $router
+            ->add('/blog/{year:[0-9]{4}}/{slug}')
+            ->setName('blog')
+        ;
+
+        $url = new Url($router);
+        $url->setBaseUri('/');
+
+        /**
+         * The second call uses the compiled template
+         */
+        for ($counter = 0; $counter < 2; $counter++) {
+            $I->assertSame(
+                '/admin/products/p/edit/1',
+                $url->get(
+                    [
+                        'for'        => 'admin',
+                        'controller' => 'products',
+                        'action'     => 'edit',
+                        'params'     => 1,
+                    ]
+                )
+            );
+
+            $I->assertSame(
+                '/blog/2025/phalcon?page=2',
+                $url->get(
+                    [
+                        'for'  => 'blog',
+                        'year' => 2025,
+                        'slug' => 'phalcon',
+                    ],
+                    [
+                        'page' => 2,
+                    ]
+                )
+            );
+        }
+
+        /**
+         * Missing variables still have their slashes normalized
+         */
+        $I->assertSame(
+            '/blog/phalcon',
+            $url->get(
+                [
+                    'for'  => 'blog',
+                    'slug' => 'phalcon',
+                ]
+            )
+        );
+
+        $url->setBaseUri('https://phalcon.io/');
+        $I->assertSame(
+            'https://phalcon.io/blog/2025/phalcon',
+            $url->get(
+                [
+                    'for'  => 'blog',
+                    'year' => 2025,
+                    'slug' => 'phalcon',
+                ]
+            )
+        );
+    }
+
     /**
      * @return array
      */
@@ -0,0 +1,65 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Session\Adapter\Libmemcached;
+
+use IntegrationTester;
+use Phalcon\Session\Adapter\Libmemcached;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+
+use function uniqid;
+
+class UpdateTimestampCest
+{
+    use DiTrait;
+
+    /**
+     * Tests Phalcon\Session\Adapter\Libmemcached :: updateTimestamp()
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     */
+    public function sessionAdapterLibmemcachedUpdateTimestamp(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Libmemcached - updateTimestamp()');
+
+        /** @var Libmemcached $adapter */
+        $adapter = $this->newService('sessionLibmemcached');
+        $value   = uniqid();
+
+        $adapter->write('test1', $value);
+
+        $I->assertTrue($adapter->updateTimestamp('test1', $value));
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        /**
+         * The key is gone, the data is written again
+         */
+        $I->clearMemcache();
+
+        $I->assertTrue($adapter->updateTimestamp('test1', $value));
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        /**
+         * Unchanged data of an evicted key
+         */
+        $I->clearMemcache();
+
+        $I->assertTrue($adapter->write('test1', $value));
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        $I->clearMemcache();
+    }
+}
@@ -15,6 +15,7 @@ namespace Phalcon\Tests\Integration\Session\Adapter\Redis;
 
 use IntegrationTester;
 use Phalcon\Session\Adapter\Redis;
+use Phalcon\Session\Manager;
 use Phalcon\Tests\Fixtures\Traits\DiTrait;
 
 use function uniqid;
@@ -49,4 +50,67 @@ class ReadWriteCest
         $actual = $adapter->read('test1');
         $I->assertNotNull($actual);
     }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: write() - merge
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     */
+    public function sessionAdapterRedisWriteMerge(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - write() - merge');
+
+        /**
+         * The data is decoded while a session is active
+         */
+        $manager = new Manager();
+        $manager->setAdapter($this->newService('sessionStream'));
+        $manager->start();
+
+        /** @var Redis $first */
+        $first = $this->newService('sessionRedis');
+        /** @var Redis $second */
+        $second = $this->newService('sessionRedis');
+
+        $first->write('merge1', 'one|s:1:"1";two|s:1:"2";');
+        $second->read('merge1');
+
+        /**
+         * Another request writes first
+         */
+        $I->assertTrue(
+            $second->write('merge1', 'one|s:1:"1";two|s:1:"2";three|s:1:"3";')
+        );
+
+        /**
+         * Only the changed key is applied to the data written meanwhile
+         */
+        $I->assertTrue(
+            $first->write('merge1', 'one|s:1:"9";two|s:1:"2";')
+        );
+
+        $expected = 'one|s:1:"9";two|s:1:"2";three|s:1:"3";';
+        $actual   = $this->newService('sessionRedis')->read('merge1');
+        $I->assertSame($expected, $actual);
+
+        /**
+         * Both sides merge, keys removed by a request stay removed
+         */
+        $I->assertTrue(
+            $second->write('merge1', 'one|s:1:"1";two|s:1:"2";three|s:1:"3";four|s:1:"4";')
+        );
+        $I->assertTrue(
+            $first->write('merge1', 'one|s:1:"9";three|s:1:"3";')
+        );
+
+        $expected = 'one|s:1:"9";three|s:1:"3";four|s:1:"4";';
+        $actual   = $this->newService('sessionRedis')->read('merge1');
+        $I->assertSame($expected, $actual);
+
+        $I->sendCommandToRedis('del', 'sess-reds-merge1');
+        $manager->destroy();
+    }
 }
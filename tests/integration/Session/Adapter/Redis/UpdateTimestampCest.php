@@ -0,0 +1,65 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Session\Adapter\Redis;
+
+use IntegrationTester;
+use Phalcon\Session\Adapter\Redis;
+use Phalcon\Tests\Fixtures\Traits\DiTrait;
+
+use function uniqid;
+
+class UpdateTimestampCest
+{
+    use DiTrait;
+
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: updateTimestamp()
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-24
+     */
+    public function sessionAdapterRedisUpdateTimestamp(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - updateTimestamp()');
+
+        /** @var Redis $adapter */
+        $adapter = $this->newService('sessionRedis');
+        $value   = uniqid();
+
+        $adapter->write('test1', $value);
+
+        $I->assertTrue($adapter->updateTimestamp('test1', $value));
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        /**
+         * The key is gone, the data is written again
+         */
+        $I->sendCommandToRedis('del', 'sess-reds-test1');
+
+        $I->assertTrue($adapter->updateTimestamp('test1', $value));
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        /**
+         * Unchanged data of an expired key
+         */
+        $I->sendCommandToRedis('del', 'sess-reds-test1');
+
+        $I->assertTrue($adapter->write('test1', $value));
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        $I->sendCommandToRedis('del', 'sess-reds-test1');
+    }
+}
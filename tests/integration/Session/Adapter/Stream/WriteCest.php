@@ -43,4 +43,41 @@ class WriteCest
         $I->seeInThisFile($value);
         $I->safeDeleteFile(cacheDir('sessions/test1'));
     }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Stream :: write() - unchanged data
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function sessionAdapterStreamWriteUnchanged(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Stream - write() - unchanged');
+
+        $adapter = $this->newService('sessionStream');
+        $file    = cacheDir('sessions/test2');
+        $value   = uniqid();
+
+        $I->assertTrue($adapter->write('test2', $value));
+        $I->assertSame($value, $adapter->read('test2'));
+
+        /**
+         * The data read is not written back
+         */
+        file_put_contents($file, 'changed');
+        touch($file, time() - 100);
+        clearstatcache();
+
+        $I->assertTrue($adapter->write('test2', $value));
+        clearstatcache();
+        $I->assertSame('changed', file_get_contents($file));
+        $I->assertGreaterThan(time() - 100, filemtime($file));
+
+        $I->assertTrue($adapter->write('test2', $value . '-new'));
+        $I->assertSame($value . '-new', file_get_contents($file));
+
+        $I->safeDeleteFile($file);
+    }
 }
@@ -52,4 +52,36 @@ class StartCest
 
         $manager->destroy();
     }
+
+    /**
+     * Tests Phalcon\Session\Manager :: start() - read only
+     *
+     * @param IntegrationTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function sessionManagerStartReadOnly(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Manager - start() - read only');
+        $manager = new Manager();
+        $files   = $this->newService('sessionStream');
+        $manager->setAdapter($files);
+
+        $I->assertTrue($manager->start());
+        $manager->set('test', 'value');
+        session_write_close();
+
+        $I->assertTrue($manager->start(true));
+        $I->assertTrue($manager->isReadOnly());
+        $I->assertFalse($manager->exists());
+        $I->assertTrue($manager->has('test'));
+        $I->assertSame('value', $manager->get('test'));
+
+        $I->assertTrue($manager->start());
+        $I->assertFalse($manager->isReadOnly());
+        $I->assertTrue($manager->exists());
+
+        $manager->destroy();
+    }
 }
@@ -0,0 +1,121 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Integration\Storage\RateLimiter;
+
+use Codeception\Example;
+use IntegrationTester;
+use Phalcon\Storage\Adapter\Memory;
+use Phalcon\Storage\Adapter\Redis;
+use Phalcon\Storage\RateLimiter;
+use Phalcon\Storage\SerializerFactory;
+
+use function getOptionsRedis;
+use function uniqid;
+
+class ConsumeCest
+{
+    /**
+     * Tests Phalcon\Storage\RateLimiter :: consume()
+     *
+     * @dataProvider getExamples
+     *
+     * @param IntegrationTester $I
+     * @param Example           $example
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function storageRateLimiterConsume(IntegrationTester $I, Example $example)
+    {
+        $I->wantToTest(
+            'Storage\RateLimiter - consume() - ' . $example['label']
+        );
+
+        if (!empty($example['extension'])) {
+            $I->checkExtensionIsLoaded($example['extension']);
+        }
+
+        $serializer = new SerializerFactory();
+        $class      = $example['class'];
+        $adapter    = new $class($serializer, $example['options']);
+        $limiter    = new RateLimiter($adapter, 3, 60, $example['algorithm']);
+        $key        = uniqid('limit-');
+
+        $actual = $limiter->consume($key);
+        $I->assertTrue($actual);
+        $I->assertSame(2, $limiter->getRemaining());
+        $I->assertSame(0, $limiter->getRetryAfter());
+
+        $actual = $limiter->consume($key, 2);
+        $I->assertTrue($actual);
+        $I->assertSame(0, $limiter->getRemaining());
+
+        $actual = $limiter->consume($key);
+        $I->assertFalse($actual);
+        $I->assertSame(0, $limiter->getRemaining());
+        $I->assertGreaterThan(0, $limiter->getRetryAfter());
+        $I->assertLessThanOrEqual(60, $limiter->getRetryAfter());
+
+        /**
+         * Other keys are not affected
+         */
+        $actual = $limiter->consume($key . '-other');
+        $I->assertTrue($actual);
+
+        $limiter->reset($key);
+
+        $actual = $limiter->consume($key);
+        $I->assertTrue($actual);
+
+        $limiter->reset($key);
+        $limiter->reset($key . '-other');
+    }
+
+    /**
+     * @return array[]
+     */
+    private function getExamples(): array
+    {
+        return [
+            [
+                'label'     => 'Memory - token bucket',
+                'class'     => Memory::class,
+                'options'   => [],
+                'algorithm' => RateLimiter::TOKEN_BUCKET,
+                'extension' => '',
+            ],
+            [
+                'label'     => 'Memory - sliding window',
+                'class'     => Memory::class,
+                'options'   => [],
+                'algorithm' => RateLimiter::SLIDING_WINDOW,
+                'extension' => '',
+            ],
+            [
+                'label'     => 'Redis - token bucket',
+                'class'     => Redis::class,
+                'options'   => getOptionsRedis(),
+                'algorithm' => RateLimiter::TOKEN_BUCKET,
+                'extension' => 'redis',
+            ],
+            [
+                'label'     => 'Redis - sliding window',
+                'class'     => Redis::class,
+                'options'   => getOptionsRedis(),
+                'algorithm' => RateLimiter::SLIDING_WINDOW,
+                'extension' => 'redis',
+            ],
+        ];
+    }
+}
@@ -0,0 +1,99 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Config\Adapter\Compiled;
+
+use Phalcon\Config\Adapter\Compiled;
+use Phalcon\Config\Config;
+use Phalcon\Config\Exception;
+use UnitTester;
+
+use function cacheDir;
+use function dataDir;
+
+class PathCest
+{
+    /**
+     * Tests Phalcon\Config\Adapter\Compiled :: path()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function configAdapterCompiledPath(UnitTester $I)
+    {
+        $I->wantToTest('Config\Adapter\Compiled - path()');
+
+        $target = cacheDir('config-compiled-path.php');
+        $config = new Compiled(
+            $target,
+            [
+                dataDir('assets/config/config.php'),
+            ]
+        );
+
+        $I->assertFileExists($target);
+
+        $I->assertSame('localhost', $config->path('database.host'));
+        $I->assertSame('yeah', $config->path('test.parent.property2'));
+        $I->assertInstanceOf(Config::class, $config->path('database'));
+        $I->assertSame('default', $config->path('database.port', 'default'));
+        $I->assertSame('localhost', $config->path('database/host', null, '/'));
+
+        /**
+         * Changes drop the index
+         */
+        $config->set('database', ['host' => '127.0.0.1']);
+
+        $I->assertSame('127.0.0.1', $config->path('database.host'));
+
+        /**
+         * Changes on the nested objects are not tracked
+         */
+        $config = new Compiled($target);
+        $config->database->host = '127.0.0.1';
+
+        $I->assertSame('localhost', $config->path('database.host'));
+
+        $config->merge(['database' => ['host' => '127.0.0.1']]);
+
+        $I->assertSame('127.0.0.1', $config->path('database.host'));
+
+        $I->safeDeleteFile($target);
+    }
+
+    /**
+     * Tests Phalcon\Config\Adapter\Compiled :: __construct() - not compiled
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function configAdapterCompiledConstructNotCompiled(UnitTester $I)
+    {
+        $I->wantToTest('Config\Adapter\Compiled - __construct() - not compiled');
+
+        $file = dataDir('assets/config/config.php');
+
+        $I->expectThrowable(
+            new Exception(
+                "The file '" . $file . "' is not a compiled configuration"
+            ),
+            function () use ($file) {
+                new Compiled($file);
+            }
+        );
+    }
+}
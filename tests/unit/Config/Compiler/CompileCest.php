@@ -0,0 +1,74 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Config\Compiler;
+
+use Phalcon\Config\Compiler;
+use UnitTester;
+
+use function cacheDir;
+use function dataDir;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Config\Compiler :: compile()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function configCompilerCompile(UnitTester $I)
+    {
+        $I->wantToTest('Config\Compiler - compile()');
+
+        $target   = cacheDir('config-compiled.php');
+        $compiler = new Compiler();
+        $sources  = [
+            dataDir('assets/config/config.php'),
+            [
+                'adapter' => 'array',
+                'config'  => [
+                    'database' => [
+                        'host' => '127.0.0.1',
+                    ],
+                ],
+            ],
+        ];
+
+        $I->assertTrue($compiler->isStale($sources, $target));
+
+        $compiler->compile($sources, $target);
+
+        $I->assertFalse($compiler->isStale($sources, $target));
+
+        $compiled = require $target;
+
+        /**
+         * The sources are merged in order
+         */
+        $I->assertSame('127.0.0.1', $compiled['config']['database']['host']);
+        $I->assertSame('demo', $compiled['config']['database']['name']);
+
+        $I->assertSame('127.0.0.1', $compiled['index']['database.host']);
+        $I->assertSame(1, $compiled['index']['test.parent.property']);
+        $I->assertSame(
+            'redis',
+            $compiled['index']['issue-12725.channel.handlers.1.name']
+        );
+        $I->assertArrayNotHasKey('database', $compiled['index']);
+
+        $I->safeDeleteFile($target);
+    }
+}
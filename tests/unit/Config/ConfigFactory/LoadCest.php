@@ -13,6 +13,7 @@ declare(strict_types=1);
 
 namespace Phalcon\Tests\Unit\Config\ConfigFactory;
 
+use Phalcon\Config\Adapter\Compiled;
 use Phalcon\Config\Adapter\Ini;
 use Phalcon\Config\Adapter\Yaml;
 use Phalcon\Config\ConfigFactory;
@@ -20,6 +21,7 @@ use Phalcon\Config\Exception;
 use Phalcon\Tests\Fixtures\Traits\FactoryTrait;
 use UnitTester;
 
+use function cacheDir;
 use function dataDir;
 use function hash;
 
@@ -226,4 +228,38 @@ class LoadCest
         $actual   = $config2->get('phalcon')->baseUri;
         $I->assertSame($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Config\ConfigFactory :: load() - compiled
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function configFactoryLoadCompiled(UnitTester $I)
+    {
+        $I->wantToTest('Config\ConfigFactory - load() - compiled');
+
+        $target = cacheDir('config-factory-compiled');
+
+        /**
+         * The sources are passed and the file is a PHP file
+         */
+        $config = (new ConfigFactory())->load(
+            [
+                'adapter'  => 'compiled',
+                'filePath' => $target,
+                'sources'  => [
+                    dataDir('assets/config/config.php'),
+                ],
+            ]
+        );
+
+        $I->assertInstanceOf(Compiled::class, $config);
+        $I->assertFileExists($target . '.php');
+        $I->assertSame('localhost', $config->path('database.host'));
+
+        $I->safeDeleteFile($target . '.php');
+    }
 }
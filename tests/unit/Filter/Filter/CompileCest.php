@@ -0,0 +1,103 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Filter\Filter;
+
+use Phalcon\Filter\FilterFactory;
+use Phalcon\Filter\Pipeline;
+use UnitTester;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Filter :: compile()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function filterFilterCompile(UnitTester $I)
+    {
+        $I->wantToTest('Filter\Filter - compile()');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $pipeline = $filter->compile(
+            [
+                'trim',
+                'replace' => [' ', '-'],
+                'remove'  => ['mary'],
+            ]
+        );
+
+        $I->assertInstanceOf(Pipeline::class, $pipeline);
+        $I->assertCount(3, $pipeline->getSteps());
+
+        $expected = '-had-a-little-lamb';
+        $actual   = $pipeline->process('  mary had a little lamb ');
+        $I->assertSame($expected, $actual);
+
+        $expected = ['-had-a-little-lamb', 'little-lamb'];
+        $actual   = $pipeline(['  mary had a little lamb ', ' little lamb']);
+        $I->assertSame($expected, $actual);
+
+        $actual = $pipeline->process(null);
+        $I->assertNull($actual);
+
+        $pipeline = $filter->compile('int');
+
+        $expected = 100019;
+        $actual   = $pipeline->process('!100a019');
+        $I->assertSame($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Filter :: compile() - memoized
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function filterFilterCompileMemoized(UnitTester $I)
+    {
+        $I->wantToTest('Filter\Filter - compile() - memoized');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $pipeline = $filter->compile(['trim', 'upper']);
+        $I->assertSame($pipeline, $filter->compile(['trim', 'upper']));
+        $I->assertNotSame($pipeline, $filter->compile(['upper', 'trim']));
+        $I->assertNotSame($pipeline, $filter->compile('trim'));
+
+        /**
+         * Registering a sanitizer resets the compiled pipelines
+         */
+        $filter->set(
+            'upper',
+            function ($input) {
+                return 'custom';
+            }
+        );
+
+        $actual = $filter->compile(['trim', 'upper']);
+        $I->assertNotSame($pipeline, $actual);
+
+        $expected = 'custom';
+        $actual   = $filter->sanitize(' abc ', ['trim', 'upper']);
+        $I->assertSame($expected, $actual);
+    }
+}
@@ -43,4 +43,36 @@ class CssCest
         $actual = $escaper->escapeCss($source);
         $I->assertSame($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Escaper :: css() - long UTF-8 input
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-20
+     */
+    public function escaperCssLongUtf8(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - css() - long UTF-8 input');
+
+        $escaper = new Escaper();
+
+        $source   = str_repeat('abcdefghijklmnopqrstuvwxyz0123456789', 2)
+            . 'ñ€😀<' . str_repeat('Z', 40);
+        $expected = str_repeat('abcdefghijklmnopqrstuvwxyz0123456789', 2)
+            . '\f1 \20ac \1f600 \3c ' . str_repeat('Z', 40);
+
+        $actual = $escaper->css($source);
+        $I->assertSame($expected, $actual);
+
+        /**
+         * Not UTF-8 - uses the encoding detection
+         */
+        $source   = mb_convert_encoding('émotion', 'ISO-8859-1', 'UTF-8');
+        $expected = '\e9 motion';
+
+        $actual = $escaper->css($source);
+        $I->assertSame($expected, $actual);
+    }
 }
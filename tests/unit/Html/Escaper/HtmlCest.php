@@ -62,4 +62,42 @@ class HtmlCest
         $actual   = $escaper->html('0');
         $I->assertSame($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Escaper :: html() - matches htmlspecialchars
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-20
+     */
+    public function escaperHtmlHtmlspecialchars(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - html() - matches htmlspecialchars');
+
+        $escaper = new Escaper();
+        $source  = str_repeat('Phalcon is "fast" & it\'s <b>ñice</b> 😀 ', 5);
+
+        $expected = htmlspecialchars($source, ENT_QUOTES | ENT_SUBSTITUTE | ENT_HTML401);
+        $actual   = $escaper->html($source);
+        $I->assertSame($expected, $actual);
+
+        $escaper->setFlags(ENT_QUOTES | ENT_HTML5);
+        $expected = htmlspecialchars($source, ENT_QUOTES | ENT_HTML5);
+        $actual   = $escaper->html($source);
+        $I->assertSame($expected, $actual);
+
+        $escaper->setFlags(ENT_NOQUOTES);
+        $expected = htmlspecialchars($source, ENT_NOQUOTES);
+        $actual   = $escaper->html($source);
+        $I->assertSame($expected, $actual);
+
+        /**
+         * Invalid UTF-8
+         */
+        $escaper  = new Escaper();
+        $expected = "a\u{FFFD}&lt;b";
+        $actual   = $escaper->html("a\x80<b");
+        $I->assertSame($expected, $actual);
+    }
 }
@@ -55,4 +55,26 @@ class JsCest
         $actual = $escaper->escapeJs($source);
         $I->assertSame($expected, $actual);
     }
+
+    /**
+     * Tests Phalcon\Escaper :: js() - long UTF-8 input
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-20
+     */
+    public function escaperJsLongUtf8(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - js() - long UTF-8 input');
+
+        $escaper = new Escaper();
+
+        $source   = str_repeat('var a = [b.c, d_e];', 3) . "alert('ü');";
+        $expected = str_repeat('var a \x3d [b.c, d_e];', 3)
+            . 'alert(\x27\xfc\x27);';
+
+        $actual = $escaper->js($source);
+        $I->assertSame($expected, $actual);
+    }
 }
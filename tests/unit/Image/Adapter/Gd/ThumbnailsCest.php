@@ -0,0 +1,211 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\Gd;
+
+use Codeception\Example;
+use Phalcon\Image\Adapter\Gd;
+use Phalcon\Image\Enum;
+use Phalcon\Image\Exception;
+use Phalcon\Tests\Fixtures\Traits\GdTrait;
+use UnitTester;
+
+use function dataDir;
+use function getimagesize;
+use function getimagesizefromstring;
+use function imagecolorat;
+use function imagecreatefromstring;
+use function imagesx;
+use function imagesy;
+use function outputDir;
+
+class ThumbnailsCest
+{
+    use GdTrait;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: thumbnails()
+     *
+     * @param UnitTester $I
+     *
+     * @return void
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-26
+     */
+    public function imageAdapterGdThumbnails(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - thumbnails()');
+
+        $this->checkJpegSupport($I);
+
+        $outputDir = 'tests/image/gd';
+        $output    = outputDir($outputDir . '/thumbnail-large.jpg');
+
+        $image = new Gd(dataDir('assets/images/example-jpg.jpg'));
+
+        $results = $image->thumbnails(
+            [
+                'small' => [
+                    'width'     => 100,
+                    'master'    => Enum::WIDTH,
+                    'extension' => 'png',
+                ],
+                'large' => [
+                    'width'  => 400,
+                    'master' => Enum::WIDTH,
+                    'file'   => $output,
+                ],
+            ]
+        );
+
+        $I->assertSame(['small', 'large'], array_keys($results));
+        $I->assertSame($output, $results['large']);
+
+        $I->amInPath(outputDir($outputDir));
+        $I->seeFileFound('thumbnail-large.jpg');
+
+        $actual = getimagesize($output);
+        $I->assertSame(400, $actual[0]);
+
+        $actual = getimagesizefromstring($results['small']);
+        $I->assertSame(100, $actual[0]);
+        $I->assertSame('image/png', $actual['mime']);
+
+        /**
+         * The loaded image is not changed
+         */
+        $I->assertSame(1820, $image->getWidth());
+        $I->assertSame(694, $image->getHeight());
+        $I->assertSame('image/jpeg', $image->getMime());
+
+        $I->safeDeleteFile('thumbnail-large.jpg');
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: thumbnails() - same as resize()
+     *
+     * @dataProvider getMasters
+     *
+     * @param UnitTester $I
+     * @param Example    $example
+     *
+     * @return void
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-26
+     */
+    public function imageAdapterGdThumbnailsResize(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Image\Adapter\Gd - thumbnails() - same as resize() - ' . $example['label']);
+
+        $this->checkJpegSupport($I);
+
+        $master = $example['master'];
+        $image  = new Gd(dataDir('assets/images/example-jpg.jpg'));
+
+        /**
+         * The stretched large thumbnail cannot be the source of the small one
+         */
+        $results = $image->thumbnails(
+            [
+                'large' => [
+                    'width'     => 800,
+                    'height'    => 200,
+                    'master'    => Enum::TENSILE,
+                    'extension' => 'png',
+                ],
+                'small' => [
+                    'width'     => 100,
+                    'height'    => 100,
+                    'master'    => $master,
+                    'extension' => 'png',
+                ],
+            ]
+        );
+
+        $resized = new Gd(dataDir('assets/images/example-jpg.jpg'));
+        $resized->resize(100, 100, $master);
+
+        $expected = imagecreatefromstring($resized->render('png'));
+        $actual   = imagecreatefromstring($results['small']);
+
+        $I->assertSame(imagesx($expected), imagesx($actual));
+        $I->assertSame(imagesy($expected), imagesy($actual));
+
+        $expectedPixels = [];
+        $actualPixels   = [];
+        for ($x = 0; $x < imagesx($expected); $x += 5) {
+            for ($y = 0; $y < imagesy($expected); $y += 5) {
+                $expectedPixels[] = imagecolorat($expected, $x, $y) & 0xFFFFFF;
+                $actualPixels[]   = imagecolorat($actual, $x, $y) & 0xFFFFFF;
+            }
+        }
+
+        $I->assertSame($expectedPixels, $actualPixels);
+    }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: thumbnails() - missing height
+     *
+     * @param UnitTester $I
+     *
+     * @return void
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-26
+     */
+    public function imageAdapterGdThumbnailsMissingHeight(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - thumbnails() - missing height');
+
+        $this->checkJpegSupport($I);
+
+        $image = new Gd(dataDir('assets/images/example-jpg.jpg'));
+
+        $I->expectThrowable(
+            new Exception('width and height must be specified'),
+            function () use ($image) {
+                $image->thumbnails(
+                    [
+                        'small' => [
+                            'width'     => 100,
+                            'extension' => 'png',
+                        ],
+                    ]
+                );
+            }
+        );
+    }
+
+    /**
+     * @return array
+     */
+    private function getMasters(): array
+    {
+        return [
+            [
+                'label'  => 'tensile',
+                'master' => Enum::TENSILE,
+            ],
+            [
+                'label'  => 'precise',
+                'master' => Enum::PRECISE,
+            ],
+            [
+                'label'  => 'none',
+                'master' => Enum::NONE,
+            ],
+        ];
+    }
+}
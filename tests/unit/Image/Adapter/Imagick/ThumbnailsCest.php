@@ -0,0 +1,86 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Image\Adapter\Imagick;
+
+use Phalcon\Image\Adapter\Imagick;
+use Phalcon\Image\Enum;
+use Phalcon\Tests\Fixtures\Traits\ImagickTrait;
+use UnitTester;
+
+use function dataDir;
+use function getimagesize;
+use function getimagesizefromstring;
+use function outputDir;
+
+class ThumbnailsCest
+{
+    use ImagickTrait;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Imagick :: thumbnails()
+     *
+     * @param UnitTester $I
+     *
+     * @return void
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-26
+     */
+    public function imageAdapterImagickThumbnails(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Imagick - thumbnails()');
+
+        $outputDir = 'tests/image/imagick';
+        $output    = outputDir($outputDir . '/thumbnail-large.jpg');
+
+        $image = new Imagick(dataDir('assets/images/example-jpg.jpg'));
+
+        $results = $image->thumbnails(
+            [
+                'small' => [
+                    'width'     => 100,
+                    'master'    => Enum::WIDTH,
+                    'extension' => 'png',
+                ],
+                'large' => [
+                    'width'  => 400,
+                    'master' => Enum::WIDTH,
+                    'file'   => $output,
+                ],
+            ]
+        );
+
+        $I->assertSame(['small', 'large'], array_keys($results));
+        $I->assertSame($output, $results['large']);
+
+        $I->amInPath(outputDir($outputDir));
+        $I->seeFileFound('thumbnail-large.jpg');
+
+        $actual = getimagesize($output);
+        $I->assertSame(400, $actual[0]);
+
+        $actual = getimagesizefromstring($results['small']);
+        $I->assertSame(100, $actual[0]);
+        $I->assertSame('image/png', $actual['mime']);
+
+        /**
+         * The loaded image is not changed
+         */
+        $I->assertSame(1820, $image->getWidth());
+        $I->assertSame(694, $image->getHeight());
+        $I->assertSame('image/JPEG', $image->getMime());
+
+        $I->safeDeleteFile('thumbnail-large.jpg');
+    }
+}
@@ -0,0 +1,178 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Logger\Adapter\Datagram;
+
+use DateTimeImmutable;
+use DateTimeZone;
+use Phalcon\Logger\Adapter\Datagram;
+use Phalcon\Logger\Enum;
+use Phalcon\Logger\Item;
+use UnitTester;
+
+use function date_default_timezone_get;
+use function fclose;
+use function stream_socket_get_name;
+use function stream_socket_recvfrom;
+use function stream_socket_server;
+use function str_repeat;
+
+use const STREAM_SERVER_BIND;
+
+class DrainCest
+{
+    /**
+     * Tests Phalcon\Logger\Adapter\Datagram :: drain()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerAdapterDatagramDrain(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Datagram - drain()');
+
+        $server = stream_socket_server(
+            'udp://127.0.0.1:0',
+            $errorCode,
+            $errorMessage,
+            STREAM_SERVER_BIND
+        );
+        $address  = 'udp://' . stream_socket_get_name($server, false);
+        $timezone = date_default_timezone_get();
+        $datetime = new DateTimeImmutable('now', new DateTimeZone($timezone));
+        $adapter  = new Datagram($address, ['finishRequest' => false]);
+
+        $adapter->process(new Item('Message 1', 'debug', Enum::DEBUG, $datetime));
+        $adapter->process(new Item('Message 2', 'debug', Enum::DEBUG, $datetime));
+
+        $I->assertSame(2, $adapter->getCount());
+
+        $actual = $adapter->drain();
+        $I->assertSame(2, $actual);
+        $I->assertSame(0, $adapter->getCount());
+
+        /**
+         * Both lines fit in one datagram
+         */
+        $packet = stream_socket_recvfrom($server, 8192);
+        $I->assertStringContainsString('Message 1', $packet);
+        $I->assertStringContainsString('Message 2', $packet);
+
+        $actual = $adapter->drain();
+        $I->assertSame(0, $actual);
+
+        $actual = $adapter->close();
+        $I->assertTrue($actual);
+
+        fclose($server);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Adapter\Datagram :: drain() - dropped
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerAdapterDatagramDrainDropped(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Datagram - drain() - dropped');
+
+        $server = stream_socket_server(
+            'udp://127.0.0.1:0',
+            $errorCode,
+            $errorMessage,
+            STREAM_SERVER_BIND
+        );
+        $address  = 'udp://' . stream_socket_get_name($server, false);
+        $timezone = date_default_timezone_get();
+        $datetime = new DateTimeImmutable('now', new DateTimeZone($timezone));
+        $adapter  = new Datagram(
+            $address,
+            [
+                'capacity'      => 2,
+                'finishRequest' => false,
+            ]
+        );
+
+        $adapter->process(new Item('Message 1', 'debug', Enum::DEBUG, $datetime));
+        $adapter->process(new Item('Message 2', 'debug', Enum::DEBUG, $datetime));
+        $adapter->process(new Item('Message 3', 'debug', Enum::DEBUG, $datetime));
+
+        $I->assertSame(2, $adapter->getCount());
+        $I->assertSame(1, $adapter->getDropped());
+
+        $actual = $adapter->drain();
+        $I->assertSame(2, $actual);
+
+        $packet = stream_socket_recvfrom($server, 8192);
+        $I->assertStringContainsString('Message 2', $packet);
+        $I->assertStringNotContainsString('Message 3', $packet);
+
+        /**
+         * The ring buffer wraps around
+         */
+        $adapter->process(new Item('Message 4', 'debug', Enum::DEBUG, $datetime));
+        $adapter->process(new Item('Message 5', 'debug', Enum::DEBUG, $datetime));
+
+        $I->assertSame(2, $adapter->drain());
+
+        $packet = stream_socket_recvfrom($server, 8192);
+        $I->assertStringContainsString('Message 4', $packet);
+        $I->assertStringContainsString('Message 5', $packet);
+
+        $adapter->close();
+        fclose($server);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Adapter\Datagram :: drain() - failed write
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerAdapterDatagramDrainFailedWrite(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Datagram - drain() - failed write');
+
+        $server = stream_socket_server(
+            'udp://127.0.0.1:0',
+            $errorCode,
+            $errorMessage,
+            STREAM_SERVER_BIND
+        );
+        $address  = 'udp://' . stream_socket_get_name($server, false);
+        $timezone = date_default_timezone_get();
+        $datetime = new DateTimeImmutable('now', new DateTimeZone($timezone));
+        $adapter  = new Datagram($address, ['packetSize' => 70000]);
+
+        /**
+         * A datagram larger than the UDP limit cannot be written
+         */
+        $adapter->process(
+            new Item(str_repeat('a', 66000), 'debug', Enum::DEBUG, $datetime)
+        );
+
+        $I->assertSame(0, $adapter->drain());
+        $I->assertSame(0, $adapter->getCount());
+        $I->assertSame(1, $adapter->getDropped());
+
+        $adapter->close();
+        fclose($server);
+    }
+}
@@ -0,0 +1,114 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Logger\Adapter\Stream;
+
+use DateTimeImmutable;
+use DateTimeZone;
+use Phalcon\Logger\Adapter\Stream;
+use Phalcon\Logger\Enum;
+use Phalcon\Logger\Item;
+use UnitTester;
+
+use function date_default_timezone_get;
+use function file_get_contents;
+use function logsDir;
+
+class FlushCest
+{
+    /**
+     * Tests Phalcon\Logger\Adapter\Stream :: flush()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerAdapterStreamFlush(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Stream - flush()');
+
+        $fileName   = $I->getNewFileName('log', 'log');
+        $outputPath = logsDir();
+        $timezone   = date_default_timezone_get();
+        $datetime   = new DateTimeImmutable('now', new DateTimeZone($timezone));
+        $adapter    = new Stream(
+            $outputPath . $fileName,
+            [
+                'bufferLines' => 3,
+            ]
+        );
+
+        $adapter->process(new Item('Message 1', 'debug', Enum::DEBUG, $datetime));
+        $adapter->process(new Item('Message 2', 'debug', Enum::DEBUG, $datetime));
+
+        $I->dontSeeFileFound($fileName, $outputPath);
+
+        $adapter->process(new Item('Message 3', 'debug', Enum::DEBUG, $datetime));
+        $adapter->process(new Item('Message 4', 'debug', Enum::DEBUG, $datetime));
+
+        $contents = file_get_contents($outputPath . $fileName);
+        $I->assertStringContainsString('Message 3', $contents);
+        $I->assertStringNotContainsString('Message 4', $contents);
+
+        $adapter->flush();
+
+        $contents = file_get_contents($outputPath . $fileName);
+        $I->assertStringContainsString('Message 4', $contents);
+
+        $actual = $adapter->close();
+        $I->assertTrue($actual);
+        $I->safeDeleteFile($outputPath . $fileName);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Adapter\Stream :: flush() - close
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerAdapterStreamFlushClose(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Stream - flush() - close');
+
+        $fileName   = $I->getNewFileName('log', 'log');
+        $outputPath = logsDir();
+        $timezone   = date_default_timezone_get();
+        $datetime   = new DateTimeImmutable('now', new DateTimeZone($timezone));
+        $adapter    = new Stream(
+            $outputPath . $fileName,
+            [
+                'bufferLines' => 100,
+            ]
+        );
+
+        $adapter->begin();
+        $adapter->add(new Item('Message 1', 'debug', Enum::DEBUG, $datetime));
+        $adapter->add(new Item('Message 2', 'debug', Enum::DEBUG, $datetime));
+        $adapter->commit();
+
+        $contents = file_get_contents($outputPath . $fileName);
+        $I->assertStringContainsString('Message 1', $contents);
+        $I->assertStringContainsString('Message 2', $contents);
+
+        $adapter->process(new Item('Message 3', 'debug', Enum::DEBUG, $datetime));
+        $adapter->close();
+
+        $contents = file_get_contents($outputPath . $fileName);
+        $I->assertStringContainsString('Message 3', $contents);
+
+        $I->safeDeleteFile($outputPath . $fileName);
+    }
+}
@@ -0,0 +1,127 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Logger\Formatter\Line;
+
+use Phalcon\Logger\Adapter\Stream;
+use Phalcon\Logger\Formatter\Line;
+use Phalcon\Logger\Item;
+use Phalcon\Logger\Logger;
+use UnitTester;
+
+use function file_get_contents;
+use function logsDir;
+
+class GetConfigurationKeyCest
+{
+    /**
+     * Tests Phalcon\Logger\Formatter\Line :: getConfigurationKey()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerFormatterLineGetConfigurationKey(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Formatter\Line - getConfigurationKey()');
+
+        $formatter = new Line('%message%', 'Y-m-d');
+
+        $expected = Line::class . '|Y-m-d|%|%|%message%';
+        $actual   = $formatter->getConfigurationKey();
+        $I->assertSame($expected, $actual);
+
+        /**
+         * Subclasses have no key
+         */
+        $I->assertNull($this->getPrefixed('one')->getConfigurationKey());
+    }
+
+    /**
+     * Tests Phalcon\Logger\Formatter\Line :: getConfigurationKey() - subclass
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerFormatterLineGetConfigurationKeySubclass(
+        UnitTester $I
+    ) {
+        $I->wantToTest('Logger\Formatter\Line - getConfigurationKey() - subclass');
+
+        $outputPath = logsDir();
+        $fileOne    = $I->getNewFileName('log', 'log');
+        $fileTwo    = $I->getNewFileName('log', 'log');
+        $adapterOne = new Stream($outputPath . $fileOne);
+        $adapterTwo = new Stream($outputPath . $fileTwo);
+
+        $adapterOne->setFormatter($this->getPrefixed('one:'));
+        $adapterTwo->setFormatter($this->getPrefixed('two:'));
+
+        $logger = new Logger(
+            'my-logger',
+            [
+                'one' => $adapterOne,
+                'two' => $adapterTwo,
+            ]
+        );
+
+        /**
+         * Each formatter formats the message with its own option
+         */
+        $logger->info('Message info');
+
+        $adapterOne->close();
+        $adapterTwo->close();
+
+        $contents = file_get_contents($outputPath . $fileOne);
+        $I->assertStringContainsString('one:Message info', $contents);
+
+        $contents = file_get_contents($outputPath . $fileTwo);
+        $I->assertStringContainsString('two:Message info', $contents);
+
+        $I->safeDeleteFile($outputPath . $fileOne);
+        $I->safeDeleteFile($outputPath . $fileTwo);
+    }
+
+    /**
+     * Returns a formatter of a Line subclass with an option of its own
+     *
+     * @param string $prefix
+     *
+     * @return Line
+     */
+    private function getPrefixed(string $prefix): Line
+    {
+        return new class ($prefix) extends Line {
+            /**
+             * @var string
+             */
+            private $prefix;
+
+            public function __construct(string $prefix)
+            {
+                parent::__construct('%message%');
+
+                $this->prefix = $prefix;
+            }
+
+            public function format(Item $item): string
+            {
+                return $this->prefix . parent::format($item);
+            }
+        };
+    }
+}
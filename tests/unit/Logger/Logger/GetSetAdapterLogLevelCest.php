@@ -0,0 +1,139 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Logger\Logger;
+
+use Phalcon\Logger\Adapter\Stream;
+use Phalcon\Logger\Enum;
+use Phalcon\Logger\Exception;
+use Phalcon\Logger\Logger;
+use UnitTester;
+
+use function file_get_contents;
+use function logsDir;
+
+class GetSetAdapterLogLevelCest
+{
+    /**
+     * Tests Phalcon\Logger :: getAdapterLogLevel()/setAdapterLogLevel()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerGetSetAdapterLogLevel(UnitTester $I)
+    {
+        $I->wantToTest('Logger - getAdapterLogLevel()/setAdapterLogLevel()');
+
+        $outputPath = logsDir();
+        $fileOne    = $I->getNewFileName('log', 'log');
+        $fileTwo    = $I->getNewFileName('log', 'log');
+        $adapterOne = new Stream($outputPath . $fileOne);
+        $adapterTwo = new Stream($outputPath . $fileTwo);
+
+        $logger = new Logger(
+            'my-logger',
+            [
+                'one' => $adapterOne,
+                'two' => $adapterTwo,
+            ]
+        );
+
+        $I->assertSame(Enum::CUSTOM, $logger->getAdapterLogLevel('one'));
+
+        $object = $logger->setAdapterLogLevel('two', Enum::ERROR);
+        $I->assertInstanceOf(Logger::class, $object);
+        $I->assertSame(Enum::ERROR, $logger->getAdapterLogLevel('two'));
+
+        $logger->info('Message info');
+        $logger->error('Message error');
+
+        $adapterOne->close();
+        $adapterTwo->close();
+
+        $contents = file_get_contents($outputPath . $fileOne);
+        $I->assertStringContainsString('Message info', $contents);
+        $I->assertStringContainsString('Message error', $contents);
+
+        $contents = file_get_contents($outputPath . $fileTwo);
+        $I->assertStringNotContainsString('Message info', $contents);
+        $I->assertStringContainsString('Message error', $contents);
+
+        $I->safeDeleteFile($outputPath . $fileOne);
+        $I->safeDeleteFile($outputPath . $fileTwo);
+    }
+
+    /**
+     * Tests Phalcon\Logger :: setAdapterLogLevel() - closure message
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerSetAdapterLogLevelClosure(UnitTester $I)
+    {
+        $I->wantToTest('Logger - setAdapterLogLevel() - closure message');
+
+        $outputPath = logsDir();
+        $fileName   = $I->getNewFileName('log', 'log');
+        $adapter    = new Stream($outputPath . $fileName);
+        $logger     = new Logger('my-logger', ['one' => $adapter]);
+        $calls      = 0;
+        $message    = function () use (&$calls) {
+            $calls++;
+
+            return 'Expensive message';
+        };
+
+        $logger->setAdapterLogLevel('one', Enum::WARNING);
+
+        /**
+         * No adapter accepts debug, the closure is never called
+         */
+        $logger->debug($message);
+        $I->assertSame(0, $calls);
+
+        $logger->warning($message);
+        $I->assertSame(1, $calls);
+
+        $adapter->close();
+
+        $contents = file_get_contents($outputPath . $fileName);
+        $I->assertStringContainsString('Expensive message', $contents);
+
+        $I->safeDeleteFile($outputPath . $fileName);
+    }
+
+    /**
+     * Tests Phalcon\Logger :: setAdapterLogLevel() - unknown adapter
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function loggerSetAdapterLogLevelUnknown(UnitTester $I)
+    {
+        $I->wantToTest('Logger - setAdapterLogLevel() - unknown adapter');
+
+        $I->expectThrowable(
+            new Exception('Adapter does not exist for this logger'),
+            function () {
+                $logger = new Logger('my-logger');
+                $logger->setAdapterLogLevel('unknown', Enum::ERROR);
+            }
+        );
+    }
+}
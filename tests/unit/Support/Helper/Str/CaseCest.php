@@ -98,6 +98,7 @@ class CaseCest
             [PascalCase::class, 'pascal', 'customer-session', 'CustomerSession', null],
             [PascalCase::class, 'pascal', 'customer Session', 'CustomerSession', ' -_'],
             [PascalCase::class, 'pascal', 'customer-Session', 'CustomerSession', ' -_'],
+            [PascalCase::class, 'pascal', "\u{00c9}COLE_\u{00e9}t\u{00e9}", "\u{00e9}cole\u{00e9}t\u{00e9}", null],
             [KebabCase::class, 'kebab', 'Camelize', 'Camelize', null],
             [KebabCase::class, 'kebab', 'CameLiZe', 'CameLiZe', null],
             [KebabCase::class, 'kebab', 'Camelize', 'Camelize', null],
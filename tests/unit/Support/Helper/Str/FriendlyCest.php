@@ -141,6 +141,31 @@ class FriendlyCest
                 'replace'   => ['e', 'a'],
                 'result'    => 'P_rch_l_rb_v_rd',
             ],
+            [
+                'message'   => 'transliteration and new lines',
+                'text'      => "\u{00dc}n\u{00ef}c\u{00f6}d\u{00e9} & \u{00d1}and\u{00fa}\r\n"
+                    . "\u{0160}koda's  \u{0110}or\u{0111}e",
+                'separator' => '-',
+                'lowercase' => true,
+                'replace'   => null,
+                'result'    => 'unicode-and-nandu-skodas-djordje',
+            ],
+            [
+                'message'   => 'transliteration not lowercase',
+                'text'      => "Cr\u{00e8}me Br\u{00fb}l\u{00e9}e / Caf\u{00e9}+Th\u{00e9}",
+                'separator' => '_',
+                'lowercase' => false,
+                'replace'   => null,
+                'result'    => 'Creme_Brulee_Cafe_The',
+            ],
+            [
+                'message'   => 'separator of two characters',
+                'text'      => '--Hello__World--',
+                'separator' => '--',
+                'lowercase' => true,
+                'replace'   => null,
+                'result'    => 'hello--world',
+            ],
         ];
     }
 }
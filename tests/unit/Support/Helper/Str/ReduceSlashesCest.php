@@ -53,5 +53,9 @@ class ReduceSlashesCest
         $expected = 'http/https';
         $actual   = $object('http//https');
         $I->assertSame($expected, $actual);
+
+        $expected = 'http://foo/bar';
+        $actual   = $object('http:///foo////bar');
+        $I->assertSame($expected, $actual);
     }
 }
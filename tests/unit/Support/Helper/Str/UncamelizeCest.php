@@ -69,6 +69,7 @@ class UncamelizeCest
             ['CameLiZe', 'came.li.ze', '.'],
             ['CameLiZe', 'came-li-ze', '-'],
             ['CAMELIZE', 'c/a/m/e/l/i/z/e', '/'],
+            ["\u{00c9}coleNormale", "\u{00e9}cole_normale", '_'],
         ];
     }
 }
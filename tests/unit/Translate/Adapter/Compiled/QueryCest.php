@@ -0,0 +1,95 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Translate\Adapter\Compiled;
+
+use Phalcon\Translate\Adapter\Compiled;
+use Phalcon\Translate\Exception;
+use Phalcon\Translate\InterpolatorFactory;
+use UnitTester;
+
+use function cacheDir;
+use function dataDir;
+
+class QueryCest
+{
+    /**
+     * Tests Phalcon\Translate\Adapter\Compiled :: query()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function translateAdapterCompiledQuery(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Compiled - query()');
+
+        $target     = cacheDir('translate-compiled-query.php');
+        $translator = new Compiled(
+            new InterpolatorFactory(),
+            [
+                'content' => $target,
+                'sources' => [
+                    [
+                        'adapter' => 'gettext',
+                        'content' => dataDir('assets/translation/gettext/es_ES.utf8/LC_MESSAGES/messages.mo'),
+                    ],
+                    [
+                        'adapter' => 'array',
+                        'content' => [
+                            'welcome' => '%greeting%, %name%!',
+                        ],
+                    ],
+                ],
+            ]
+        );
+
+        $I->assertFileExists($target);
+        $I->assertTrue($translator->has('welcome'));
+        $I->assertFalse($translator->has('unknown'));
+
+        $I->assertSame('Hola', $translator->query('hi'));
+        $I->assertSame('Hola Phalcon', $translator->query('hello-key', ['name' => 'Phalcon']));
+        $I->assertSame('Hola %name%', $translator->query('hello-key'));
+        $I->assertSame(
+            'Hello, %name%!',
+            $translator->_('welcome', ['greeting' => 'Hello'])
+        );
+        $I->assertSame('unknown', $translator->query('unknown'));
+        $I->assertSame('Hola %name%', $translator->toArray()['hello-key']);
+
+        /**
+         * Other interpolators receive the message
+         */
+        $translator = new Compiled(
+            new InterpolatorFactory(),
+            [
+                'content'             => $target,
+                'defaultInterpolator' => 'indexedArray',
+                'triggerError'        => true,
+            ]
+        );
+
+        $I->assertSame('Hola %name%', $translator->query('hello-key'));
+
+        $I->expectThrowable(
+            new Exception('Cannot find translation key: unknown'),
+            function () use ($translator) {
+                $translator->query('unknown');
+            }
+        );
+
+        $I->safeDeleteFile($target);
+    }
+}
@@ -0,0 +1,138 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Tests\Unit\Translate\Compiler;
+
+use Phalcon\Translate\Compiler;
+use Phalcon\Translate\Exception;
+use UnitTester;
+
+use function cacheDir;
+use function dataDir;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Translate\Compiler :: compile()
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function translateCompilerCompile(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Compiler - compile()');
+
+        $target   = cacheDir('translate-compiled-fr.php');
+        $compiler = new Compiler();
+        $sources  = [
+            [
+                'adapter'   => 'csv',
+                'content'   => dataDir('assets/translation/csv/fr_FR.csv'),
+                'delimiter' => '|',
+                'enclosure' => "'",
+            ],
+            [
+                'adapter' => 'array',
+                'content' => [
+                    'hi'      => 'Salut',
+                    'welcome' => 'Welcome %name%',
+                ],
+            ],
+        ];
+
+        $I->assertTrue($compiler->isStale($sources, $target));
+
+        $compiler->compile($sources, $target);
+
+        $I->assertFalse($compiler->isStale($sources, $target));
+
+        $catalog = require $target;
+
+        /**
+         * The first source wins, the others fill in the missing keys
+         */
+        $I->assertSame('Bonjour', $catalog['hi']);
+        $I->assertSame('Au revoir', $catalog['bye']);
+        $I->assertSame(['Welcome ', 'name', ''], $catalog['welcome']);
+        $I->assertSame(
+            ['La chanson est ', 'song', ' (', 'artist', ')'],
+            $catalog['song-key']
+        );
+
+        $I->safeDeleteFile($target);
+    }
+
+    /**
+     * Tests Phalcon\Translate\Compiler :: compile() - gettext
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function translateCompilerCompileGettext(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Compiler - compile() - gettext');
+
+        $target   = cacheDir('translate-compiled-es.php');
+        $compiler = new Compiler();
+
+        $count = $compiler->compile(
+            [
+                [
+                    'adapter' => 'gettext',
+                    'content' => dataDir('assets/translation/gettext/es_ES.utf8/LC_MESSAGES/messages.mo'),
+                ],
+            ],
+            $target
+        );
+
+        $catalog = require $target;
+
+        $I->assertSame(count($catalog), $count);
+        $I->assertSame('Hola', $catalog['hi']);
+        $I->assertSame(['Hola ', 'name', ''], $catalog['hello-key']);
+
+        $I->safeDeleteFile($target);
+    }
+
+    /**
+     * Tests Phalcon\Translate\Compiler :: compile() - unknown adapter
+     *
+     * @param UnitTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2025-03-22
+     */
+    public function translateCompilerCompileUnknownAdapter(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Compiler - compile() - unknown adapter');
+
+        $I->expectThrowable(
+            new Exception("The adapter 'yaml' cannot be compiled"),
+            function () {
+                (new Compiler())->compile(
+                    [
+                        [
+                            'adapter' => 'yaml',
+                            'content' => 'messages.yml',
+                        ],
+                    ],
+                    cacheDir('translate-compiled-yaml.php')
+                );
+            }
+        );
+    }
+}